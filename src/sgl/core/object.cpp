@@ -13,6 +13,8 @@ namespace sgl {
 
 static void (*object_inc_ref_py)(PyObject*) noexcept = nullptr;
 static void (*object_dec_ref_py)(PyObject*) noexcept = nullptr;
+static void* (*object_acquire_gil_py)() noexcept = nullptr;
+static void (*object_release_gil_py)(void*) noexcept = nullptr;
 
 #if SGL_ENABLE_OBJECT_TRACKING
 static std::mutex s_tracked_objects_mutex;
@@ -49,6 +51,20 @@ void Object::inc_ref() const noexcept
     }
 }
 
+bool Object::try_inc_ref() const noexcept
+{
+    uintptr_t value = m_state.load(std::memory_order_relaxed);
+
+    while (true) {
+        // Reviving a Python owned object needs the GIL, and its reference count may already be zero.
+        if (!(value & 1) || value == 1)
+            return false;
+        if (!m_state.compare_exchange_weak(value, value + 2, std::memory_order_relaxed, std::memory_order_relaxed))
+            continue;
+        return true;
+    }
+}
+
 void Object::dec_ref(bool dealloc) const noexcept
 {
     uintptr_t value = m_state.load(std::memory_order_relaxed);
@@ -60,6 +76,9 @@ void Object::dec_ref(bool dealloc) const noexcept
                 abort();
             } else if (value == 3) {
                 if (dealloc) {
+                    // Release the last reference before deleting, so that try_inc_ref() fails from now on.
+                    if (!m_state.compare_exchange_weak(value, 1, std::memory_order_relaxed, std::memory_order_relaxed))
+                        continue;
                     delete this;
                 } else {
                     m_state.store(1, std::memory_order_relaxed);
@@ -180,10 +199,28 @@ void Object::set_enable_ref_tracking(bool enable)
 
 #endif // SGL_ENABLE_REF_TRACKING
 
-void object_init_py(void (*object_inc_ref_py_)(PyObject*) noexcept, void (*object_dec_ref_py_)(PyObject*) noexcept)
+void object_init_py(
+    void (*object_inc_ref_py_)(PyObject*) noexcept,
+    void (*object_dec_ref_py_)(PyObject*) noexcept,
+    void* (*object_acquire_gil_py_)() noexcept,
+    void (*object_release_gil_py_)(void*) noexcept
+)
 {
     object_inc_ref_py = object_inc_ref_py_;
     object_dec_ref_py = object_dec_ref_py_;
+    object_acquire_gil_py = object_acquire_gil_py_;
+    object_release_gil_py = object_release_gil_py_;
+}
+
+ScopedGILPy::ScopedGILPy()
+    : m_state(object_acquire_gil_py ? object_acquire_gil_py() : nullptr)
+{
+}
+
+ScopedGILPy::~ScopedGILPy()
+{
+    if (object_release_gil_py)
+        object_release_gil_py(m_state);
 }
 
 } // namespace sgl
@@ -119,6 +119,13 @@ public:
     /// Increase the object's reference count.
     void inc_ref() const noexcept;
 
+    /// Increase the object's reference count unless the last reference has already been released.
+    /// This allows a non-owning cache to safely revive objects that may be destroyed concurrently.
+    /// Objects owned by Python are never revived, as that requires the GIL (see \c ScopedGILPy).
+    /// While the GIL is held they cannot be destroyed concurrently, so \c inc_ref can be used instead.
+    /// \return True if the reference count was increased.
+    bool try_inc_ref() const noexcept;
+
     /// Decrease the object's reference count and potentially deallocate it.
     void dec_ref(bool dealloc = true) const noexcept;
 
@@ -187,10 +194,33 @@ public:
  *
  * Python binding code must invoke `object_init_py` and provide functions that
  * can be used to increase/decrease the Python reference count of an instance
- * (i.e., `Py_INCREF` / `Py_DECREF`).
+ * (i.e., `Py_INCREF` / `Py_DECREF`), and optionally functions to acquire and
+ * release the GIL (i.e., `PyGILState_Ensure` / `PyGILState_Release`).
+ */
+SGL_API void object_init_py(
+    void (*object_inc_ref_py)(PyObject*) noexcept,
+    void (*object_dec_ref_py)(PyObject*) noexcept,
+    void* (*object_acquire_gil_py)() noexcept = nullptr,
+    void (*object_release_gil_py)(void*) noexcept = nullptr
+);
+
+/**
+ * \brief Holds the Python GIL for its lifetime.
+ *
+ * Uses the handlers installed with \c object_init_py and does nothing if Python
+ * support is not initialized. Acquiring the GIL is reentrant.
  */
-SGL_API void
-object_init_py(void (*object_inc_ref_py)(PyObject*) noexcept, void (*object_dec_ref_py)(PyObject*) noexcept);
+class SGL_API ScopedGILPy {
+public:
+    ScopedGILPy();
+    ~ScopedGILPy();
+
+    ScopedGILPy(const ScopedGILPy&) = delete;
+    ScopedGILPy& operator=(const ScopedGILPy&) = delete;
+
+private:
+    void* m_state;
+};
 
 
 #if SGL_ENABLE_REF_TRACKING
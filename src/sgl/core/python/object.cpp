@@ -17,6 +17,11 @@ SGL_PY_EXPORT(core_object)
         {
             nb::gil_scoped_acquire guard;
             Py_DECREF(o);
+        },
+        []() noexcept { return reinterpret_cast<void*>(static_cast<intptr_t>(PyGILState_Ensure())); },
+        [](void* state) noexcept
+        {
+            PyGILState_Release(static_cast<PyGILState_STATE>(reinterpret_cast<intptr_t>(state)));
         }
     );
 
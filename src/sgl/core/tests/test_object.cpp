@@ -63,6 +63,35 @@ TEST_CASE("ref")
     CHECK_EQ(DummyObject::get_count(), 0);
 }
 
+class DyingObject : public Object {
+    SGL_OBJECT(DyingObject)
+public:
+    ~DyingObject() { get_revived() = try_inc_ref(); }
+
+    static bool& get_revived()
+    {
+        static bool s_revived = false;
+        return s_revived;
+    }
+};
+
+TEST_CASE("try_inc_ref")
+{
+    ref<DummyObject> r1 = make_ref<DummyObject>();
+    CHECK(r1->try_inc_ref());
+    CHECK_EQ(r1->ref_count(), 2);
+    r1->dec_ref();
+    CHECK_EQ(r1->ref_count(), 1);
+    r1 = nullptr;
+    CHECK_EQ(DummyObject::get_count(), 0);
+
+    // Objects whose last reference has been released cannot be revived.
+    DyingObject::get_revived() = true;
+    ref<DyingObject> r2 = make_ref<DyingObject>();
+    r2 = nullptr;
+    CHECK_FALSE(DyingObject::get_revived());
+}
+
 class DummyBuffer;
 
 class DummyDevice : public Object {
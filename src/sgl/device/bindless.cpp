@@ -0,0 +1,226 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "bindless.h"
+
+#include "sgl/device/device.h"
+#include "sgl/device/resource.h"
+#include "sgl/device/sampler.h"
+#include "sgl/device/shader_object.h"
+#include "sgl/device/reflection.h"
+
+#include "sgl/core/error.h"
+
+namespace sgl {
+
+static void set_slot(const ShaderCursor& slot, const ref<Texture>& texture)
+{
+    slot.set_texture(texture);
+}
+
+static void set_slot(const ShaderCursor& slot, const ref<Buffer>& buffer)
+{
+    slot.set_buffer(buffer);
+}
+
+static void set_slot(const ShaderCursor& slot, const ref<Sampler>& sampler)
+{
+    slot.set_sampler(sampler);
+}
+
+BindlessResourceTable::BindlessResourceTable(Device* device, BindlessResourceTableDesc desc)
+    : m_device(device)
+    , m_desc(std::move(desc))
+{
+    SGL_CHECK(m_desc.texture_capacity > 0, "Texture capacity must be greater than zero.");
+    SGL_CHECK(m_desc.buffer_capacity > 0, "Buffer capacity must be greater than zero.");
+    SGL_CHECK(m_desc.sampler_capacity > 0, "Sampler capacity must be greater than zero.");
+}
+
+BindlessResourceTable::~BindlessResourceTable() { }
+
+uint32_t BindlessResourceTable::add_texture(ref<Texture> texture)
+{
+    SGL_CHECK_NOT_NULL(texture);
+    SGL_CHECK(texture->type() == TextureType::texture_2d, "Bindless textures must be 2D textures.");
+    SGL_CHECK(
+        is_set(texture->desc().usage, TextureUsage::shader_resource),
+        "Bindless textures must have shader resource usage."
+    );
+    std::lock_guard lock(m_mutex);
+    return add(m_textures, std::move(texture), m_desc.texture_capacity, "texture", "textures");
+}
+
+uint32_t BindlessResourceTable::add_buffer(ref<Buffer> buffer)
+{
+    SGL_CHECK_NOT_NULL(buffer);
+    SGL_CHECK(
+        is_set(buffer->desc().usage, BufferUsage::shader_resource),
+        "Bindless buffers must have shader resource usage."
+    );
+    std::lock_guard lock(m_mutex);
+    return add(m_buffers, std::move(buffer), m_desc.buffer_capacity, "buffer", "buffers");
+}
+
+uint32_t BindlessResourceTable::add_sampler(ref<Sampler> sampler)
+{
+    SGL_CHECK_NOT_NULL(sampler);
+    std::lock_guard lock(m_mutex);
+    return add(m_samplers, std::move(sampler), m_desc.sampler_capacity, "sampler", "samplers");
+}
+
+void BindlessResourceTable::remove_texture(uint32_t index)
+{
+    std::lock_guard lock(m_mutex);
+    remove(m_textures, index, "texture", "textures");
+}
+
+void BindlessResourceTable::remove_buffer(uint32_t index)
+{
+    std::lock_guard lock(m_mutex);
+    remove(m_buffers, index, "buffer", "buffers");
+}
+
+void BindlessResourceTable::remove_sampler(uint32_t index)
+{
+    std::lock_guard lock(m_mutex);
+    remove(m_samplers, index, "sampler", "samplers");
+}
+
+uint32_t BindlessResourceTable::texture_count() const
+{
+    std::lock_guard lock(m_mutex);
+    return m_textures.count;
+}
+
+uint32_t BindlessResourceTable::buffer_count() const
+{
+    std::lock_guard lock(m_mutex);
+    return m_buffers.count;
+}
+
+uint32_t BindlessResourceTable::sampler_count() const
+{
+    std::lock_guard lock(m_mutex);
+    return m_samplers.count;
+}
+
+void BindlessResourceTable::bind(ShaderCursor cursor, const ShaderProgram* program)
+{
+    SGL_CHECK_NOT_NULL(program);
+    if (cursor.is_valid())
+        cursor = cursor.find_field("g_bindless_resources");
+    if (!cursor.is_valid())
+        return;
+
+    std::lock_guard lock(m_mutex);
+
+    // The parameter block layout is owned by the linked program, which is replaced on hot reload.
+    CachedObject& cached = m_cached_objects[program];
+    if (!cached.shader_object || cached.flat_layouts != program->_flat_layouts()) {
+        slang::TypeLayoutReflection* type_layout = cursor.slang_type_layout()->getElementTypeLayout();
+        cached.shader_object = m_device->create_shader_object(
+            TypeLayoutReflection::from_slang(ref<const Object>(program->_flat_layouts()), type_layout)
+        );
+        cached.flat_layouts = program->_flat_layouts();
+        ShaderCursor table(cached.shader_object);
+        ShaderCursor textures = table["textures"];
+        for (uint32_t i = 0; i < m_textures.resources.size(); ++i)
+            if (m_textures.resources[i])
+                textures[i].set_texture(m_textures.resources[i]);
+        ShaderCursor buffers = table["buffers"];
+        for (uint32_t i = 0; i < m_buffers.resources.size(); ++i)
+            if (m_buffers.resources[i])
+                buffers[i].set_buffer(m_buffers.resources[i]);
+        ShaderCursor samplers = table["samplers"];
+        for (uint32_t i = 0; i < m_samplers.resources.size(); ++i)
+            if (m_samplers.resources[i])
+                samplers[i].set_sampler(m_samplers.resources[i]);
+    }
+    cursor.set_object(cached.shader_object);
+    cached.bound = true;
+}
+
+void BindlessResourceTable::_release_program(const ShaderProgram* program)
+{
+    CachedObject cached;
+    {
+        std::lock_guard lock(m_mutex);
+        auto it = m_cached_objects.find(program);
+        if (it == m_cached_objects.end())
+            return;
+        cached = std::move(it->second);
+        m_cached_objects.erase(it);
+    }
+    // The shader object and program data are released outside the lock.
+}
+
+std::string BindlessResourceTable::to_string() const
+{
+    std::lock_guard lock(m_mutex);
+    return fmt::format(
+        "BindlessResourceTable(\n"
+        "  texture_count = {},\n"
+        "  texture_capacity = {},\n"
+        "  buffer_count = {},\n"
+        "  buffer_capacity = {},\n"
+        "  sampler_count = {},\n"
+        "  sampler_capacity = {}\n"
+        ")",
+        m_textures.count,
+        m_desc.texture_capacity,
+        m_buffers.count,
+        m_desc.buffer_capacity,
+        m_samplers.count,
+        m_desc.sampler_capacity
+    );
+}
+
+template<typename T>
+uint32_t
+BindlessResourceTable::add(Slots<T>& slots, ref<T> resource, uint32_t capacity, const char* kind, const char* field)
+{
+    uint32_t index;
+    if (!slots.free_indices.empty()) {
+        index = slots.free_indices.back();
+        slots.free_indices.pop_back();
+    } else {
+        SGL_CHECK(slots.resources.size() < capacity, "Bindless {} table is full (capacity {}).", kind, capacity);
+        index = narrow_cast<uint32_t>(slots.resources.size());
+        slots.resources.emplace_back();
+    }
+    slots.resources[index] = std::move(resource);
+    slots.count++;
+
+    update_slot(field, index, slots.resources[index]);
+    return index;
+}
+
+template<typename T>
+void BindlessResourceTable::remove(Slots<T>& slots, uint32_t index, const char* kind, const char* field)
+{
+    SGL_CHECK(index < slots.resources.size() && slots.resources[index], "Invalid bindless {} index {}.", kind, index);
+    slots.resources[index] = nullptr;
+    slots.free_indices.push_back(index);
+    slots.count--;
+
+    update_slot(field, index, slots.resources[index]);
+}
+
+template<typename T>
+void BindlessResourceTable::update_slot(const char* field, uint32_t index, const ref<T>& resource)
+{
+    for (auto& [program, cached] : m_cached_objects) {
+        if (!cached.shader_object)
+            continue;
+        // Work recorded with a bound object references it until executed, so the object is
+        // dropped and rebuilt on the next bind instead of being modified.
+        if (cached.bound) {
+            cached.shader_object = nullptr;
+            cached.bound = false;
+            continue;
+        }
+        set_slot(ShaderCursor(cached.shader_object)[field][index], resource);
+    }
+}
+
+} // namespace sgl
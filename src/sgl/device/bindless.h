@@ -0,0 +1,131 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "sgl/device/fwd.h"
+#include "sgl/device/shader_cursor.h"
+
+#include "sgl/core/macros.h"
+#include "sgl/core/object.h"
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace sgl {
+
+struct BindlessResourceTableDesc {
+    /// Number of texture slots.
+    uint32_t texture_capacity{1024};
+    /// Number of buffer slots.
+    uint32_t buffer_capacity{1024};
+    /// Number of sampler slots.
+    uint32_t sampler_capacity{64};
+};
+
+/**
+ * Device level table of textures, buffers and samplers that shaders can index directly.
+ *
+ * Resources are added to the table once and referenced by a stable index, which shaders use
+ * through the accessors in \c sgl/device/bindless.slang (\c BindlessTexture, \c BindlessBuffer
+ * and \c BindlessSampler). Indices of removed resources are reused by later additions.
+ *
+ * The table is exposed to shaders as the global parameter block \c g_bindless_resources, which
+ * is bound automatically when a pipeline is bound. The table keeps one shader object per program,
+ * so binding the table costs a single object binding per dispatch. The object is patched one slot
+ * at a time when resources are added or removed. Once it has been bound, the next change drops it
+ * instead and the next bind builds a new one, so adding, removing or replacing a resource never
+ * affects work already recorded, even if it has not been submitted yet.
+ */
+class SGL_API BindlessResourceTable : public Object {
+    SGL_OBJECT(BindlessResourceTable)
+public:
+    BindlessResourceTable(Device* device, BindlessResourceTableDesc desc);
+    ~BindlessResourceTable();
+
+    const BindlessResourceTableDesc& desc() const { return m_desc; }
+
+    /// Add a texture to the table. The texture is bound as \c Texture2D in shaders.
+    /// \return Index of the texture.
+    uint32_t add_texture(ref<Texture> texture);
+
+    /// Add a buffer to the table. The buffer is bound as \c ByteAddressBuffer in shaders.
+    /// \return Index of the buffer.
+    uint32_t add_buffer(ref<Buffer> buffer);
+
+    /// Add a sampler to the table.
+    /// \return Index of the sampler.
+    uint32_t add_sampler(ref<Sampler> sampler);
+
+    /// Remove a texture from the table, releasing its index.
+    void remove_texture(uint32_t index);
+
+    /// Remove a buffer from the table, releasing its index.
+    void remove_buffer(uint32_t index);
+
+    /// Remove a sampler from the table, releasing its index.
+    void remove_sampler(uint32_t index);
+
+    /// Number of textures in the table.
+    uint32_t texture_count() const;
+
+    /// Number of buffers in the table.
+    uint32_t buffer_count() const;
+
+    /// Number of samplers in the table.
+    uint32_t sampler_count() const;
+
+    /// Bind the table to the \c g_bindless_resources parameter block of a root shader object.
+    /// Does nothing if the shader does not use the table.
+    /// \param cursor Cursor to the root shader object.
+    /// \param program Program the root shader object was created for.
+    void bind(ShaderCursor cursor, const ShaderProgram* program);
+
+    /// Drop the shader object cached for a program. Called when the program is destroyed.
+    void _release_program(const ShaderProgram* program);
+
+    std::string to_string() const override;
+
+private:
+    template<typename T>
+    struct Slots {
+        std::vector<ref<T>> resources;
+        std::vector<uint32_t> free_indices;
+        uint32_t count{0};
+    };
+
+    struct CachedObject {
+        /// Flattened type layouts of the program at the time the object was built.
+        /// Keeps the program's layout alive and identifies the object as outdated after a reload.
+        ref<FlatTypeLayoutCache> flat_layouts;
+        ref<ShaderObject> shader_object;
+        /// True if the object has been bound since it was built, i.e. recorded work may reference it.
+        bool bound{false};
+    };
+
+    template<typename T>
+    uint32_t add(Slots<T>& slots, ref<T> resource, uint32_t capacity, const char* kind, const char* field);
+
+    template<typename T>
+    void remove(Slots<T>& slots, uint32_t index, const char* kind, const char* field);
+
+    /// Write a slot of all cached shader objects.
+    template<typename T>
+    void update_slot(const char* field, uint32_t index, const ref<T>& resource);
+
+    Device* m_device;
+    BindlessResourceTableDesc m_desc;
+
+    mutable std::mutex m_mutex;
+
+    Slots<Texture> m_textures;
+    Slots<Buffer> m_buffers;
+    Slots<Sampler> m_samplers;
+
+    /// Shader objects built for the parameter block layouts of bound programs.
+    /// Entries are removed when their program is destroyed.
+    std::unordered_map<const ShaderProgram*, CachedObject> m_cached_objects;
+};
+
+} // namespace sgl
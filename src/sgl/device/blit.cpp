@@ -134,6 +134,10 @@ ref<ShaderProgram> Blitter::get_program(ProgramKey key)
     if (it != m_program_cache.end())
         return it->second;
 
+    // Blits may be recorded on worker threads (see Device::record_parallel), so the
+    // compilation is serialized with any other use of the slang sessions.
+    std::lock_guard lock(m_device->_shader_compile_mutex());
+
     std::string source;
     source += fmt::format(
         "#define SRC_LAYOUT {}\n"
@@ -161,6 +165,8 @@ ref<ShaderProgram> Blitter::get_program(ProgramKey key)
 
 ref<RenderPipeline> Blitter::get_pipeline(ProgramKey key, Format dst_format)
 {
+    std::lock_guard lock(m_mutex);
+
     auto it = m_pipeline_cache.find({key, dst_format});
     if (it != m_pipeline_cache.end())
         return it->second;
@@ -10,6 +10,7 @@
 #include "sgl/math/vector_types.h"
 
 #include <map>
+#include <mutex>
 
 namespace sgl {
 
@@ -90,6 +91,8 @@ private:
 
     std::map<ProgramKey, ref<ShaderProgram>> m_program_cache;
     std::map<std::pair<ProgramKey, Format>, ref<RenderPipeline>> m_pipeline_cache;
+    /// Protects the caches, allowing blits to be recorded from multiple threads.
+    std::mutex m_mutex;
 };
 
 } // namespace sgl
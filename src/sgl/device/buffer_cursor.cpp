@@ -4,16 +4,54 @@
 
 #include "sgl/device/shader_object.h"
 #include "sgl/device/resource.h"
+#include "sgl/device/device.h"
+#include "sgl/device/command.h"
 #include "sgl/device/cuda_interop.h"
 #include "sgl/device/cursor_utils.h"
 
 #include "sgl/core/error.h"
+#include "sgl/core/maths.h"
 
 #include "sgl/math/vector_types.h"
 #include "sgl/math/matrix_types.h"
 
+#include <charconv>
+#include <optional>
+
 namespace sgl {
 
+static std::optional<Struct::Type> scalar_to_struct_type(TypeReflection::ScalarType scalar_type)
+{
+    switch (scalar_type) {
+    case TypeReflection::ScalarType::int8:
+        return Struct::Type::int8;
+    case TypeReflection::ScalarType::int16:
+        return Struct::Type::int16;
+    case TypeReflection::ScalarType::int32:
+        return Struct::Type::int32;
+    case TypeReflection::ScalarType::int64:
+        return Struct::Type::int64;
+    case TypeReflection::ScalarType::uint8:
+        return Struct::Type::uint8;
+    case TypeReflection::ScalarType::uint16:
+        return Struct::Type::uint16;
+    // Booleans are stored as 32-bit integers on the device.
+    case TypeReflection::ScalarType::bool_:
+    case TypeReflection::ScalarType::uint32:
+        return Struct::Type::uint32;
+    case TypeReflection::ScalarType::uint64:
+        return Struct::Type::uint64;
+    case TypeReflection::ScalarType::float16:
+        return Struct::Type::float16;
+    case TypeReflection::ScalarType::float32:
+        return Struct::Type::float32;
+    case TypeReflection::ScalarType::float64:
+        return Struct::Type::float64;
+    default:
+        return {};
+    }
+}
+
 BufferElementCursor::BufferElementCursor(ref<TypeLayoutReflection> layout, ref<BufferCursor> owner)
     : m_type_layout(std::move(layout))
     , m_buffer(std::move(owner))
@@ -115,12 +153,16 @@ void BufferElementCursor::_set_array(
     size_t element_count
 )
 {
-    ref<const TypeReflection> element_type = m_type_layout->unwrap_array()->type();
-    size_t element_size = cursor_utils::get_scalar_type_size(element_type->scalar_type());
+    const FlatTypeLayout* layout = m_type_layout->flat_layout();
+    size_t element_size = cursor_utils::get_scalar_type_size(layout->leaf_scalar_type);
 
-    cursor_utils::check_array(m_type_layout->slang_target(), size, scalar_type, element_count);
+    cursor_utils::check_cached(
+        layout,
+        cursor_utils::value_type_key(TypeReflection::Kind::array, scalar_type, 0, 0, size),
+        [&] { cursor_utils::check_array(layout, size, scalar_type, element_count); }
+    );
 
-    size_t stride = m_type_layout->element_stride();
+    size_t stride = layout->element_stride;
     if (element_size == stride) {
         write_data(m_offset, data, size);
     } else {
@@ -142,7 +184,7 @@ void BufferElementCursor::_get_array(
     ref<const TypeReflection> element_type = m_type_layout->unwrap_array()->type();
     size_t element_size = cursor_utils::get_scalar_type_size(element_type->scalar_type());
 
-    cursor_utils::check_array(m_type_layout->slang_target(), size, scalar_type, element_count);
+    cursor_utils::check_array(m_type_layout->flat_layout(), size, scalar_type, element_count);
 
     size_t stride = m_type_layout->element_stride();
     if (element_size == stride) {
@@ -157,13 +199,18 @@ void BufferElementCursor::_get_array(
 }
 void BufferElementCursor::_set_scalar(const void* data, size_t size, TypeReflection::ScalarType scalar_type)
 {
-    cursor_utils::check_scalar(m_type_layout->slang_target(), size, scalar_type);
+    const FlatTypeLayout* layout = m_type_layout->flat_layout();
+    cursor_utils::check_cached(
+        layout,
+        cursor_utils::value_type_key(TypeReflection::Kind::scalar, scalar_type, 1, 1, size),
+        [&] { cursor_utils::check_scalar(layout, size, scalar_type); }
+    );
     write_data(m_offset, data, size);
 }
 
 void BufferElementCursor::_get_scalar(void* data, size_t size, TypeReflection::ScalarType scalar_type) const
 {
-    cursor_utils::check_scalar(m_type_layout->slang_target(), size, scalar_type);
+    cursor_utils::check_scalar(m_type_layout->flat_layout(), size, scalar_type);
     read_data(m_offset, data, size);
 }
 
@@ -174,14 +221,19 @@ void BufferElementCursor::_set_vector(
     int dimension
 )
 {
-    cursor_utils::check_vector(m_type_layout->slang_target(), size, scalar_type, dimension);
+    const FlatTypeLayout* layout = m_type_layout->flat_layout();
+    cursor_utils::check_cached(
+        layout,
+        cursor_utils::value_type_key(TypeReflection::Kind::vector, scalar_type, 1, dimension, size),
+        [&] { cursor_utils::check_vector(layout, size, scalar_type, dimension); }
+    );
     write_data(m_offset, data, size);
 }
 
 void BufferElementCursor::_get_vector(void* data, size_t size, TypeReflection::ScalarType scalar_type, int dimension)
     const
 {
-    cursor_utils::check_vector(m_type_layout->slang_target(), size, scalar_type, dimension);
+    cursor_utils::check_vector(m_type_layout->flat_layout(), size, scalar_type, dimension);
     read_data(m_offset, data, size);
 }
 
@@ -193,7 +245,12 @@ void BufferElementCursor::_set_matrix(
     int cols
 )
 {
-    cursor_utils::check_matrix(m_type_layout->slang_target(), size, scalar_type, rows, cols);
+    const FlatTypeLayout* layout = m_type_layout->flat_layout();
+    cursor_utils::check_cached(
+        layout,
+        cursor_utils::value_type_key(TypeReflection::Kind::matrix, scalar_type, rows, cols, size),
+        [&] { cursor_utils::check_matrix(layout, size, scalar_type, rows, cols); }
+    );
     write_data(m_offset, data, size);
 }
 
@@ -205,7 +262,7 @@ void BufferElementCursor::_get_matrix(
     int cols
 ) const
 {
-    cursor_utils::check_matrix(m_type_layout->slang_target(), size, scalar_type, rows, cols);
+    cursor_utils::check_matrix(m_type_layout->flat_layout(), size, scalar_type, rows, cols);
     read_data(m_offset, data, size);
 }
 
@@ -481,55 +538,394 @@ BufferElementCursor BufferCursor::find_element(uint32_t index)
     return element_cursor;
 }
 
+template<typename Func>
+void BufferCursor::for_each_dirty_range(Func func) const
+{
+    size_t page_count = m_dirty_pages.size();
+    for (size_t page = 0; page < page_count;) {
+        if (!m_dirty_pages[page]) {
+            ++page;
+            continue;
+        }
+        size_t end_page = page;
+        while (end_page < page_count && m_dirty_pages[end_page])
+            ++end_page;
+        size_t begin = page * PAGE_SIZE;
+        size_t end = std::min(end_page * PAGE_SIZE, m_size);
+        func(begin, end - begin);
+        page = end_page;
+    }
+}
+
 void BufferCursor::write_data(size_t offset, const void* data, size_t size)
 {
     if (!m_buffer) {
-        // Load data on demand if haven't done so yet.
         SGL_CHECK(m_resource, "Buffer resource not set");
-        if (m_load_before_write)
-            load();
-        else
-            m_buffer = new uint8_t[m_size];
+        allocate();
     }
 
     SGL_CHECK(offset + size <= m_size, "Buffer overflow");
+    if (size == 0)
+        return;
+
+    if (m_resource) {
+        size_t first_page = offset / PAGE_SIZE;
+        size_t last_page = (offset + size - 1) / PAGE_SIZE;
+
+        // Pages that are only partially overwritten need their current contents.
+        if (m_load_before_write) {
+            if (offset > first_page * PAGE_SIZE || offset + size < std::min((first_page + 1) * PAGE_SIZE, m_size))
+                load_pages(first_page * PAGE_SIZE, 1);
+            if (offset + size < std::min((last_page + 1) * PAGE_SIZE, m_size))
+                load_pages(last_page * PAGE_SIZE, 1);
+        }
+
+        for (size_t page = first_page; page <= last_page; ++page) {
+            m_loaded_pages[page] = true;
+            m_dirty_pages[page] = true;
+        }
+    }
+
     memcpy(m_buffer + offset, data, size);
 }
 
 void BufferCursor::read_data(size_t offset, void* data, size_t size) const
 {
+    // Treating local buffer as cache, so allowing loading from device even from const function.
+    BufferCursor* self = const_cast<BufferCursor*>(this);
     if (!m_buffer) {
-        // Load data on demand if haven't done so yet.
-        // (note: treating local buffer as cache, so allowing call
-        // to load_from_device to it even from const function).
         SGL_CHECK(m_resource, "Buffer resource not set");
-        const_cast<BufferCursor*>(this)->load();
+        self->allocate();
     }
 
     SGL_CHECK(offset + size <= m_size, "Buffer overflow");
+    if (m_resource)
+        self->load_pages(offset, size);
     memcpy(data, m_buffer + offset, size);
 }
 
+void BufferCursor::write_columns(std::span<const BufferColumn> columns, size_t first, size_t count)
+{
+    // Resolve and validate all columns up front, so an invalid column does not leave a partial write behind.
+    std::vector<BufferFieldAccessor> accessors;
+    accessors.reserve(columns.size());
+    for (const BufferColumn& column : columns) {
+        BufferFieldAccessor& accessor = accessors.emplace_back(ref(this), column.path);
+        accessor.check_range(first, count);
+        accessor.check_column(count, column.size, column.type);
+    }
+    for (size_t i = 0; i < columns.size(); ++i)
+        accessors[i].set_range(first, count, columns[i].data, columns[i].size, columns[i].type);
+}
+
 void BufferCursor::load()
 {
     if (m_resource) {
-        if (!m_buffer) {
-            m_buffer = new uint8_t[m_size];
+        if (!m_buffer)
+            allocate();
+        std::fill(m_loaded_pages.begin(), m_loaded_pages.end(), false);
+        std::fill(m_dirty_pages.begin(), m_dirty_pages.end(), false);
+        load_pages(0, m_size);
+    }
+}
+
+void BufferCursor::apply()
+{
+    if (!m_resource || !m_buffer || m_resource->memory_type() == MemoryType::read_back)
+        return;
+
+    if (m_resource->memory_type() == MemoryType::upload) {
+        for_each_dirty_range([&](size_t offset, size_t size)
+                             { m_resource->set_data(m_buffer + offset, size, m_offset + offset); });
+    } else {
+        // Record all dirty ranges into a single command buffer.
+        ref<CommandEncoder> command_encoder;
+        for_each_dirty_range(
+            [&](size_t offset, size_t size)
+            {
+                if (!command_encoder)
+                    command_encoder = m_resource->device()->create_command_encoder();
+                command_encoder->upload_buffer_data(m_resource, m_offset + offset, size, m_buffer + offset);
+            }
+        );
+        if (command_encoder)
+            m_resource->device()->submit_command_buffer(command_encoder->finish());
+    }
+
+    std::fill(m_dirty_pages.begin(), m_dirty_pages.end(), false);
+}
+
+size_t BufferCursor::dirty_size() const
+{
+    size_t dirty_size = 0;
+    for_each_dirty_range([&](size_t, size_t size) { dirty_size += size; });
+    return dirty_size;
+}
+
+void BufferCursor::allocate()
+{
+    SGL_ASSERT(m_resource && !m_buffer);
+    m_buffer = new uint8_t[m_size];
+    size_t page_count = div_round_up(m_size, PAGE_SIZE);
+    m_loaded_pages.assign(page_count, false);
+    m_dirty_pages.assign(page_count, false);
+}
+
+void BufferCursor::load_pages(size_t offset, size_t size)
+{
+    SGL_ASSERT(m_resource && m_buffer);
+    if (size == 0)
+        return;
+
+    size_t last_page = (offset + size - 1) / PAGE_SIZE;
+    for (size_t page = offset / PAGE_SIZE; page <= last_page;) {
+        if (m_loaded_pages[page]) {
+            ++page;
+            continue;
         }
-        if (m_resource->memory_type() != MemoryType::upload) {
-            m_resource->get_data(m_buffer, m_size, m_offset);
+        // Load runs of consecutive pages with a single read.
+        size_t end_page = page;
+        while (end_page <= last_page && !m_loaded_pages[end_page])
+            m_loaded_pages[end_page++] = true;
+        size_t begin = page * PAGE_SIZE;
+        size_t end = std::min(end_page * PAGE_SIZE, m_size);
+        // Upload buffers cannot be read, their initial contents are undefined.
+        if (m_resource->memory_type() != MemoryType::upload)
+            m_resource->get_data(m_buffer + begin, end - begin, m_offset + begin);
+        page = end_page;
+    }
+}
+
+BufferFieldAccessor::BufferFieldAccessor(ref<BufferCursor> cursor, std::string_view path)
+    : m_cursor(std::move(cursor))
+    , m_path(path)
+{
+    SGL_CHECK_NOT_NULL(m_cursor);
+
+    ref<const TypeLayoutReflection> type_layout = m_cursor->element_type_layout();
+    size_t offset = 0;
+    size_t pos = 0;
+    while (pos < path.size()) {
+        if (path[pos] == '[') {
+            size_t end = path.find(']', pos);
+            SGL_CHECK(end != std::string_view::npos, "Invalid field path \"{}\": missing ']'.", path);
+            std::string_view index_str = path.substr(pos + 1, end - pos - 1);
+            uint32_t index = 0;
+            auto [ptr, ec] = std::from_chars(index_str.data(), index_str.data() + index_str.size(), index);
+            SGL_CHECK(
+                !index_str.empty() && ec == std::errc() && ptr == index_str.data() + index_str.size(),
+                "Invalid field path \"{}\": invalid index \"{}\".",
+                path,
+                index_str
+            );
+            TypeReflection::Kind kind = type_layout->kind();
+            SGL_CHECK(
+                kind == TypeReflection::Kind::array || kind == TypeReflection::Kind::vector
+                    || kind == TypeReflection::Kind::matrix,
+                "Invalid field path \"{}\": \"{}\" cannot be indexed.",
+                path,
+                type_layout->name()
+            );
+            size_t element_count = type_layout->element_count();
+            SGL_CHECK(
+                element_count == 0 || index < element_count,
+                "Invalid field path \"{}\": index {} out of range (element count {}).",
+                path,
+                index,
+                element_count
+            );
+            offset += index * type_layout->element_stride();
+            type_layout = type_layout->element_type_layout();
+            pos = end + 1;
+        } else {
+            if (path[pos] == '.' && pos > 0)
+                pos++;
+            size_t end = std::min(path.find_first_of(".[", pos), path.size());
+            std::string_view name = path.substr(pos, end - pos);
+            SGL_CHECK(!name.empty(), "Invalid field path \"{}\": empty field name.", path);
+            int32_t field_index = type_layout->kind() == TypeReflection::Kind::struct_
+                ? type_layout->find_field_index_by_name(name.data(), name.data() + name.size())
+                : -1;
+            SGL_CHECK(field_index >= 0, "Invalid field path \"{}\": field \"{}\" not found.", path, name);
+            ref<const VariableLayoutReflection> field_layout = type_layout->get_field_by_index(field_index);
+            offset += field_layout->offset();
+            type_layout = field_layout->type_layout();
+            pos = end;
         }
     }
+
+    m_type_layout = std::move(type_layout);
+    m_offset = offset;
 }
 
-void BufferCursor::apply()
+BufferElementCursor BufferFieldAccessor::find_element(size_t index) const
 {
-    if (m_resource && m_buffer) {
-        if (m_resource->memory_type() != MemoryType::read_back) {
-            m_resource->set_data(m_buffer, m_size, m_offset);
+    SGL_CHECK(is_valid(), "Invalid accessor");
+    check_range(index, 1);
+    BufferElementCursor field_cursor;
+    field_cursor.m_buffer = m_cursor;
+    field_cursor.m_type_layout = m_type_layout;
+    field_cursor.m_offset = index * m_cursor->element_stride() + m_offset;
+    return field_cursor;
+}
+
+void BufferFieldAccessor::set_range(size_t first, size_t count, const void* data) const
+{
+    SGL_CHECK(is_valid(), "Invalid accessor");
+    SGL_CHECK(
+        m_type_layout->parameter_category() == TypeReflection::ParameterCategory::uniform,
+        "\"{}\" cannot bind data",
+        m_type_layout->name()
+    );
+    check_range(first, count);
+
+    size_t size = this->size();
+    size_t stride = m_cursor->element_stride();
+    size_t offset = first * stride + m_offset;
+    if (size == stride) {
+        m_cursor->write_data(offset, data, count * size);
+    } else {
+        const uint8_t* src = reinterpret_cast<const uint8_t*>(data);
+        for (size_t i = 0; i < count; ++i) {
+            m_cursor->write_data(offset, src, size);
+            src += size;
+            offset += stride;
+        }
+    }
+}
+
+void BufferFieldAccessor::get_range(size_t first, size_t count, void* data) const
+{
+    SGL_CHECK(is_valid(), "Invalid accessor");
+    SGL_CHECK(
+        m_type_layout->parameter_category() == TypeReflection::ParameterCategory::uniform,
+        "\"{}\" cannot read data",
+        m_type_layout->name()
+    );
+    check_range(first, count);
+
+    size_t size = this->size();
+    size_t stride = m_cursor->element_stride();
+    size_t offset = first * stride + m_offset;
+    if (size == stride) {
+        m_cursor->read_data(offset, data, count * size);
+    } else {
+        uint8_t* dst = reinterpret_cast<uint8_t*>(data);
+        for (size_t i = 0; i < count; ++i) {
+            m_cursor->read_data(offset, dst, size);
+            dst += size;
+            offset += stride;
         }
     }
 }
 
+void BufferFieldAccessor::set_range(
+    size_t first,
+    size_t count,
+    const void* data,
+    size_t size,
+    Struct::Type type
+) const
+{
+    SGL_CHECK(is_valid(), "Invalid accessor");
+    check_range(first, count);
+    auto [component_type, component_count] = check_column(count, size, type);
+
+    if (type == component_type) {
+        set_range(first, count, data);
+        return;
+    }
+
+    ref<Struct> src_struct = make_ref<Struct>();
+    ref<Struct> dst_struct = make_ref<Struct>();
+    for (size_t i = 0; i < component_count; ++i) {
+        std::string name = fmt::format("c{}", i);
+        src_struct->append(name, type);
+        dst_struct->append(name, component_type);
+    }
+    StructConverter converter(src_struct, dst_struct);
+
+    // Convert in chunks that stay in cache and scatter each chunk into the elements.
+    static constexpr size_t CHUNK_SIZE = 4096;
+    std::vector<uint8_t> converted(std::min(count, CHUNK_SIZE) * this->size());
+    const uint8_t* src = reinterpret_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < count; i += CHUNK_SIZE) {
+        size_t chunk_count = std::min(CHUNK_SIZE, count - i);
+        converter.convert(src, converted.data(), chunk_count);
+        set_range(first + i, chunk_count, converted.data());
+        src += chunk_count * src_struct->size();
+    }
+}
+
+std::pair<Struct::Type, size_t> BufferFieldAccessor::check_column(size_t count, size_t size, Struct::Type type) const
+{
+    // Determine the scalar type and number of scalar components of the field.
+    ref<const TypeReflection> field_type = m_type_layout->type();
+    size_t component_count = field_type->is_array() ? field_type->total_element_count() : 1;
+    ref<const TypeReflection> leaf_type = field_type->unwrap_array();
+    switch (leaf_type->kind()) {
+    case TypeReflection::Kind::scalar:
+        break;
+    case TypeReflection::Kind::vector:
+        component_count *= leaf_type->col_count();
+        break;
+    case TypeReflection::Kind::matrix:
+        component_count *= leaf_type->row_count() * leaf_type->col_count();
+        break;
+    default:
+        SGL_THROW("\"{}\" cannot be written from column data", m_type_layout->name());
+    }
+    std::optional<Struct::Type> component_type = scalar_to_struct_type(leaf_type->scalar_type());
+    SGL_CHECK(
+        component_type,
+        "\"{}\" has unsupported scalar type {}",
+        m_type_layout->name(),
+        leaf_type->scalar_type()
+    );
+    SGL_CHECK(
+        component_count * Struct::type_size(*component_type) == this->size(),
+        "\"{}\" contains padding and cannot be written from column data",
+        m_type_layout->name()
+    );
+    SGL_CHECK(
+        size == count * component_count * Struct::type_size(type),
+        "Data size ({}) does not match {} elements of \"{}\" with scalar type {}",
+        size,
+        count,
+        m_type_layout->name(),
+        type
+    );
+    return {*component_type, component_count};
+}
+
+std::string BufferFieldAccessor::to_string() const
+{
+    if (!is_valid())
+        return "BufferFieldAccessor()";
+    return fmt::format(
+        "BufferFieldAccessor(\n"
+        "  path = \"{}\",\n"
+        "  type = {},\n"
+        "  offset = {},\n"
+        "  size = {}\n"
+        ")",
+        m_path,
+        m_type_layout->type()->full_name(),
+        m_offset,
+        size()
+    );
+}
+
+void BufferFieldAccessor::check_range(size_t first, size_t count) const
+{
+    size_t element_count = m_cursor->element_count();
+    SGL_CHECK(
+        first <= element_count && count <= element_count - first,
+        "Range [{}, {}) out of range in buffer with element count {}",
+        first,
+        first + count,
+        element_count
+    );
+}
 
 } // namespace sgl
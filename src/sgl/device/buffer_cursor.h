@@ -9,8 +9,13 @@
 
 #include "sgl/core/config.h"
 #include "sgl/core/macros.h"
+#include "sgl/core/struct.h"
 
+#include <span>
+#include <string>
 #include <string_view>
+#include <utility>
+#include <vector>
 
 namespace sgl {
 
@@ -65,6 +70,20 @@ public:
     template<typename T>
     void set(const T& value);
 
+    /// Write a scalar, vector or matrix value without type checks.
+    /// The caller is responsible for \c T matching the field type.
+    /// With \c SGL_ENABLE_CURSOR_DEBUG_CHECKS, this behaves like \c set.
+    template<typename T>
+    void set_unchecked(const T& value)
+    {
+#if SGL_ENABLE_CURSOR_DEBUG_CHECKS
+        set(value);
+#else
+        static_assert(sizeof(CursorValueTraits<T>) > 0, "Only scalar, vector and matrix types are supported");
+        write_data(m_offset, &value, sizeof(T));
+#endif
+    }
+
     void _set_array(const void* data, size_t size, TypeReflection::ScalarType scalar_type, size_t element_count);
     void _set_scalar(const void* data, size_t size, TypeReflection::ScalarType scalar_type);
     void _set_vector(const void* data, size_t size, TypeReflection::ScalarType scalar_type, int dimension);
@@ -84,6 +103,19 @@ private:
     size_t m_offset{0};
 
     friend class BufferCursor;
+    friend class BufferFieldAccessor;
+};
+
+/// Host data for a single field of a range of elements, see \c BufferCursor::write_columns.
+struct BufferColumn {
+    /// Field path within an element (see \c BufferFieldAccessor).
+    std::string path;
+    /// Field values, one tightly packed value per element.
+    const void* data{nullptr};
+    /// Size of the data in bytes.
+    size_t size{0};
+    /// Scalar type of the values, converted to the scalar type of the field if different.
+    Struct::Type type{Struct::Type::float32};
 };
 
 /// Represents a list of elements in a block of memory, and provides
@@ -145,21 +177,54 @@ public:
     bool is_loaded() const { return m_buffer != nullptr; }
 
     /// Write data to buffer (note: writes only to host memory).
+    /// For cursors onto a buffer resource, the written pages are marked dirty.
     void write_data(size_t offset, const void* data, size_t size);
 
     /// Reads data from buffer (note: reads only from host memory).
+    /// For cursors onto a buffer resource, pages are loaded on first access.
     void read_data(size_t offset, void* data, size_t size) const;
 
+    /**
+     * Write fields of a range of elements from column data.
+     *
+     * Each column is scattered into the strided element layout in a single native pass.
+     * Values whose scalar type differs from the field's scalar type are converted with a
+     * \c StructConverter. All columns are validated before any data is written.
+     *
+     * \param columns Columns to write.
+     * \param first Index of the first element.
+     * \param count Number of elements.
+     */
+    void write_columns(std::span<const BufferColumn> columns, size_t first, size_t count);
+
     /// In case of GPU only buffers, loads all data from GPU.
+    /// Discards any changes that have not been applied.
     void load();
 
-    /// In case of GPU only buffers, pushes all data to the GPU.
+    /// In case of GPU only buffers, pushes modified data to the GPU.
+    /// Only dirty pages are uploaded, with adjacent pages coalesced into a single copy.
     void apply();
 
+    /// Number of bytes that will be uploaded by the next call to \c apply.
+    size_t dirty_size() const;
+
     /// Get the resource this cursor represents (if any).
     ref<Buffer> resource() const { return m_resource; }
 
+    /// Granularity of dirty tracking and lazy loading for cursors onto a buffer resource.
+    static constexpr size_t PAGE_SIZE = 64 * 1024;
+
 private:
+    /// Allocate the host copy of a buffer resource.
+    void allocate();
+
+    /// Load the pages overlapping a byte range that have not been loaded yet.
+    void load_pages(size_t offset, size_t size);
+
+    /// Visit coalesced ranges of consecutive dirty pages as (offset, size) in bytes.
+    template<typename Func>
+    void for_each_dirty_range(Func func) const;
+
     ref<const TypeLayoutReflection> m_element_type_layout;
     ref<Buffer> m_resource;
     uint8_t* m_buffer{nullptr};
@@ -167,6 +232,110 @@ private:
     bool m_owner{false};
     DeviceOffset m_offset{0};
     bool m_load_before_write{true};
+
+    /// Per page state of the host copy of a buffer resource.
+    std::vector<bool> m_loaded_pages;
+    std::vector<bool> m_dirty_pages;
+};
+
+/**
+ * Field path within the elements of a buffer cursor, resolved once and reused for many elements.
+ *
+ * Indexing a \c BufferElementCursor by name looks up the field in the type layout on every
+ * access. An accessor resolves a path such as "transform" or "lights[2].color" up front and
+ * caches the resulting type layout and byte offset, so accessing the field of an element is
+ * reduced to an offset computation. Fields of a range of elements can also be read and written
+ * in bulk from tightly packed host memory.
+ */
+class SGL_API BufferFieldAccessor {
+public:
+    BufferFieldAccessor() = default;
+
+    /// Resolve a field path for the elements of a buffer cursor.
+    /// Fields are separated by '.' and array, vector and matrix elements are selected with "[index]".
+    BufferFieldAccessor(ref<BufferCursor> cursor, std::string_view path);
+
+    /// The buffer cursor this accessor refers to.
+    ref<BufferCursor> cursor() const { return m_cursor; }
+
+    /// The field path.
+    const std::string& path() const { return m_path; }
+
+    /// Type layout of the field.
+    ref<const TypeLayoutReflection> type_layout() const { return m_type_layout; }
+
+    /// Offset of the field within an element in bytes.
+    size_t offset() const { return m_offset; }
+
+    /// Size of the field in bytes.
+    size_t size() const { return m_type_layout->size(); }
+
+    bool is_valid() const { return m_cursor != nullptr; }
+
+    /// Get a cursor to the field of the element at a given index.
+    BufferElementCursor find_element(size_t index) const;
+
+    /// Index operator to get a cursor to the field of the element at a given index.
+    BufferElementCursor operator[](size_t index) const { return find_element(index); }
+
+    template<typename T>
+    void set(size_t index, const T& value) const
+    {
+        find_element(index).set(value);
+    }
+
+    template<typename T>
+    T get(size_t index) const
+    {
+        return find_element(index).as<T>();
+    }
+
+    /**
+     * Write the field of a range of elements.
+     *
+     * \param first Index of the first element.
+     * \param count Number of elements.
+     * \param data Field values, tightly packed (\c count * \c size() bytes).
+     */
+    void set_range(size_t first, size_t count, const void* data) const;
+
+    /**
+     * Read the field of a range of elements.
+     *
+     * \param first Index of the first element.
+     * \param count Number of elements.
+     * \param data Destination for the field values, tightly packed (\c count * \c size() bytes).
+     */
+    void get_range(size_t first, size_t count, void* data) const;
+
+    /**
+     * Write the field of a range of elements from values of a different scalar type.
+     *
+     * Values are converted to the scalar type of the field with a \c StructConverter.
+     * The field must be a scalar, vector or matrix (or an array thereof) without padding.
+     *
+     * \param first Index of the first element.
+     * \param count Number of elements.
+     * \param data Field values, tightly packed.
+     * \param size Size of the data in bytes.
+     * \param type Scalar type of the values.
+     */
+    void set_range(size_t first, size_t count, const void* data, size_t size, Struct::Type type) const;
+
+    std::string to_string() const;
+
+private:
+    void check_range(size_t first, size_t count) const;
+
+    /// Check that column data matches the field and return the scalar type and component count of the field.
+    std::pair<Struct::Type, size_t> check_column(size_t count, size_t size, Struct::Type type) const;
+
+    ref<BufferCursor> m_cursor;
+    std::string m_path;
+    ref<const TypeLayoutReflection> m_type_layout;
+    size_t m_offset{0};
+
+    friend class BufferCursor;
 };
 
 
@@ -0,0 +1,278 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "buffer_heap.h"
+
+#include "sgl/device/device.h"
+
+#include "sgl/core/error.h"
+#include "sgl/core/maths.h"
+#include "sgl/core/string.h"
+
+#include <algorithm>
+#include <bit>
+
+namespace sgl {
+
+/// Number of blocks in the first page of a size class.
+static constexpr size_t MIN_BLOCKS_PER_PAGE = 16;
+
+// ----------------------------------------------------------------------------
+// BufferHeap
+// ----------------------------------------------------------------------------
+
+BufferHeap::BufferHeap(ref<Device> device, BufferHeapDesc desc)
+    : DeviceResource(std::move(device))
+    , m_desc(std::move(desc))
+{
+    SGL_CHECK(is_power_of_two(m_desc.min_block_size), "'min_block_size' must be a power of two");
+    SGL_CHECK(m_desc.page_size >= m_desc.min_block_size, "'page_size' must be at least 'min_block_size'");
+
+    for (size_t block_size = m_desc.min_block_size; block_size <= m_desc.page_size; block_size *= 2)
+        m_size_classes.push_back({.block_size = block_size});
+}
+
+BufferHeap::~BufferHeap()
+{
+    // All allocations hold a reference to the heap, so all blocks are free at this point.
+    SGL_ASSERT(m_allocation_count == 0);
+}
+
+ref<BufferHeapAllocation> BufferHeap::allocate(size_t size)
+{
+    SGL_CHECK(size > 0, "Cannot allocate zero sized block");
+
+    size_t block_size = std::max(m_desc.min_block_size, std::bit_ceil(size));
+
+    // Requests larger than a page get a dedicated buffer.
+    if (block_size > m_desc.page_size) {
+        size_t dedicated_size = align_to(m_desc.min_block_size, size);
+        ref<Buffer> buffer = m_device->create_buffer({
+            .size = dedicated_size,
+            .memory_type = m_desc.memory_type,
+            .persistent_map = m_desc.memory_type != MemoryType::device_local,
+            .usage = m_desc.usage,
+            .label = m_desc.label.empty() ? "buffer_heap_dedicated" : m_desc.label + "_dedicated",
+        });
+        {
+            std::lock_guard lock(m_mutex);
+            m_requested_size += size;
+            m_allocated_size += dedicated_size;
+            m_dedicated_size += dedicated_size;
+            m_allocation_count++;
+        }
+        return make_ref<BufferHeapAllocation>(ref<BufferHeap>(this), std::move(buffer), 0, size, nullptr);
+    }
+
+    uint32_t size_class_index = std::countr_zero(block_size) - std::countr_zero(m_desc.min_block_size);
+
+    std::lock_guard lock(m_mutex);
+
+    SizeClass& size_class = m_size_classes[size_class_index];
+    Page* page = nullptr;
+    DeviceOffset offset = 0;
+
+    // Reuse the oldest freed block if its submission has finished.
+    // Free blocks are ordered by submit ID, so only the front needs to be checked.
+    if (!size_class.free_blocks.empty()) {
+        const FreeBlock& block = size_class.free_blocks.front();
+        if (block.submit_id <= m_completed_submit_id || m_device->is_submit_finished(block.submit_id)) {
+            m_completed_submit_id = std::max(m_completed_submit_id, block.submit_id);
+            page = block.page;
+            offset = block.offset;
+            size_class.free_blocks.pop_front();
+        }
+    }
+
+    // Otherwise carve a new block, creating a new page if needed.
+    // Pages start small and double in size, so rarely used size classes do not reserve a full page.
+    if (!page) {
+        if (size_class.pages.empty()
+            || size_class.pages.back()->next_offset + block_size > size_class.pages.back()->buffer->size()) {
+            size_t page_size = size_class.pages.empty() ? block_size * MIN_BLOCKS_PER_PAGE
+                                                        : size_class.pages.back()->buffer->size() * 2;
+            page_size = std::min(page_size, m_desc.page_size);
+            ref<Buffer> buffer = m_device->create_buffer({
+                .size = page_size,
+                .memory_type = m_desc.memory_type,
+                .persistent_map = m_desc.memory_type != MemoryType::device_local,
+                .usage = m_desc.usage,
+                .label = m_desc.label.empty() ? "buffer_heap_page" : m_desc.label + "_page",
+            });
+            size_class.pages.push_back(std::make_unique<Page>(Page{
+                .buffer = std::move(buffer),
+                .size_class = size_class_index,
+            }));
+        }
+        page = size_class.pages.back().get();
+        offset = page->next_offset;
+        page->next_offset += block_size;
+    }
+
+    page->live_blocks++;
+    m_requested_size += size;
+    m_allocated_size += block_size;
+    m_allocation_count++;
+
+    return make_ref<BufferHeapAllocation>(ref<BufferHeap>(this), page->buffer, offset, size, page);
+}
+
+void BufferHeap::release(Page* page, DeviceOffset offset, size_t size)
+{
+    std::lock_guard lock(m_mutex);
+
+    m_requested_size -= size;
+    m_allocation_count--;
+
+    if (!page) {
+        size_t dedicated_size = align_to(m_desc.min_block_size, size);
+        m_allocated_size -= dedicated_size;
+        m_dedicated_size -= dedicated_size;
+        return;
+    }
+
+    SizeClass& size_class = m_size_classes[page->size_class];
+    m_allocated_size -= size_class.block_size;
+    page->live_blocks--;
+
+    // The block may still be referenced by the last submission, so it only becomes
+    // reusable once that has finished executing (immediately if nothing is pending).
+    // Submit IDs are monotonic, so the queue stays ordered.
+    size_class.free_blocks.push_back({
+        .page = page,
+        .offset = offset,
+        .submit_id = m_device->last_submit_id(),
+    });
+}
+
+void BufferHeap::trim()
+{
+    std::lock_guard lock(m_mutex);
+
+    for (SizeClass& size_class : m_size_classes) {
+        // A page can be released if it has no live blocks and none of its freed blocks are pending.
+        std::vector<Page*> pending_pages;
+        for (const FreeBlock& block : size_class.free_blocks)
+            if (!m_device->is_submit_finished(block.submit_id))
+                pending_pages.push_back(block.page);
+
+        auto is_unused = [&](const Page* page)
+        {
+            return page->live_blocks == 0
+                && std::find(pending_pages.begin(), pending_pages.end(), page) == pending_pages.end();
+        };
+
+        std::erase_if(size_class.free_blocks, [&](const FreeBlock& block) { return is_unused(block.page); });
+        std::erase_if(size_class.pages, [&](const std::unique_ptr<Page>& page) { return is_unused(page.get()); });
+    }
+}
+
+BufferHeapStats BufferHeap::stats() const
+{
+    std::lock_guard lock(m_mutex);
+
+    BufferHeapStats stats;
+    size_t pending_free_size = 0;
+    for (const SizeClass& size_class : m_size_classes) {
+        stats.page_count += size_class.pages.size();
+        for (const auto& page : size_class.pages)
+            stats.reserved_size += page->buffer->size();
+        for (const FreeBlock& block : size_class.free_blocks)
+            if (!m_device->is_submit_finished(block.submit_id))
+                pending_free_size += size_class.block_size;
+    }
+    stats.reserved_size += m_dedicated_size;
+    stats.allocated_size = m_allocated_size;
+    stats.requested_size = m_requested_size;
+    stats.pending_free_size = pending_free_size;
+    stats.allocation_count = m_allocation_count;
+    if (stats.reserved_size > 0)
+        stats.occupancy = float(m_allocated_size + pending_free_size) / float(stats.reserved_size);
+    if (m_allocated_size > 0)
+        stats.fragmentation = 1.f - float(m_requested_size) / float(m_allocated_size);
+    return stats;
+}
+
+std::string BufferHeap::to_string() const
+{
+    BufferHeapStats stats = this->stats();
+    return fmt::format(
+        "BufferHeap(\n"
+        "  device = {},\n"
+        "  memory_type = {},\n"
+        "  usage = {},\n"
+        "  page_size = {},\n"
+        "  page_count = {},\n"
+        "  reserved_size = {},\n"
+        "  allocation_count = {},\n"
+        "  label = {}\n"
+        ")",
+        m_device,
+        m_desc.memory_type,
+        m_desc.usage,
+        string::format_byte_size(m_desc.page_size),
+        stats.page_count,
+        string::format_byte_size(stats.reserved_size),
+        stats.allocation_count,
+        m_desc.label
+    );
+}
+
+// ----------------------------------------------------------------------------
+// BufferHeapAllocation
+// ----------------------------------------------------------------------------
+
+BufferHeapAllocation::BufferHeapAllocation(
+    ref<BufferHeap> heap,
+    ref<Buffer> buffer,
+    DeviceOffset offset,
+    size_t size,
+    BufferHeap::Page* page
+)
+    : m_heap(std::move(heap))
+    , m_buffer(std::move(buffer))
+    , m_offset(offset)
+    , m_size(size)
+    , m_page(page)
+{
+}
+
+BufferHeapAllocation::~BufferHeapAllocation()
+{
+    m_heap->release(m_page, m_offset, m_size);
+}
+
+ref<BufferView> BufferHeapAllocation::create_view(Format format) const
+{
+    return m_buffer->create_view({
+        .format = format,
+        .range = {.offset = m_offset, .size = m_size},
+    });
+}
+
+void BufferHeapAllocation::set_data(const void* data, size_t size, DeviceOffset offset)
+{
+    SGL_CHECK(offset + size <= m_size, "'offset' / 'size' out of range");
+    m_buffer->set_data(data, size, m_offset + offset);
+}
+
+void BufferHeapAllocation::get_data(void* data, size_t size, DeviceOffset offset)
+{
+    SGL_CHECK(offset + size <= m_size, "'offset' / 'size' out of range");
+    m_buffer->get_data(data, size, m_offset + offset);
+}
+
+std::string BufferHeapAllocation::to_string() const
+{
+    return fmt::format(
+        "BufferHeapAllocation(\n"
+        "  buffer = {},\n"
+        "  offset = {},\n"
+        "  size = {}\n"
+        ")",
+        string::indent(m_buffer->to_string()),
+        m_offset,
+        m_size
+    );
+}
+
+} // namespace sgl
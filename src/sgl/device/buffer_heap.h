@@ -0,0 +1,183 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "sgl/device/fwd.h"
+#include "sgl/device/types.h"
+#include "sgl/device/resource.h"
+#include "sgl/device/device_resource.h"
+
+#include "sgl/core/macros.h"
+#include "sgl/core/object.h"
+
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace sgl {
+
+struct BufferHeapDesc {
+    /// Memory type of the backing buffers.
+    MemoryType memory_type{MemoryType::device_local};
+    /// Resource usage flags of the backing buffers.
+    BufferUsage usage{
+        BufferUsage::shader_resource | BufferUsage::unordered_access | BufferUsage::copy_source
+        | BufferUsage::copy_destination
+    };
+    /// Maximum size of each backing buffer (page) in bytes.
+    size_t page_size{16 * 1024 * 1024};
+    /// Smallest size class in bytes. Also the alignment of all allocations.
+    size_t min_block_size{256};
+    /// Debug label.
+    std::string label;
+};
+
+struct BufferHeapStats {
+    /// Number of backing buffers.
+    size_t page_count{0};
+    /// Total size of the backing buffers in bytes.
+    size_t reserved_size{0};
+    /// Total size of blocks handed out in bytes (including size class rounding).
+    size_t allocated_size{0};
+    /// Total size requested by live allocations in bytes.
+    size_t requested_size{0};
+    /// Total size of freed blocks waiting for their submission to finish in bytes.
+    size_t pending_free_size{0};
+    /// Number of live allocations.
+    size_t allocation_count{0};
+    /// Fraction of reserved memory occupied by live or pending blocks.
+    float occupancy{0.f};
+    /// Fraction of allocated memory lost to size class rounding.
+    float fragmentation{0.f};
+};
+
+/**
+ * Sub-allocating heap for many small buffers.
+ *
+ * Allocations are rounded up to power of two size classes and carved out of
+ * backing buffers (pages). Each page serves a single size class. The first page
+ * of a size class holds a few blocks, each further page doubles in size up to
+ * \c BufferHeapDesc::page_size. Requests larger than the page size get a
+ * dedicated backing buffer.
+ *
+ * Freed blocks are recycled once the last submission at the time of release has
+ * finished executing, or immediately if no submission is pending. As with \c Buffer,
+ * an allocation must be kept alive until the commands referencing it are submitted.
+ */
+class SGL_API BufferHeap : public DeviceResource {
+    SGL_OBJECT(BufferHeap)
+public:
+    BufferHeap(ref<Device> device, BufferHeapDesc desc);
+    ~BufferHeap();
+
+    const BufferHeapDesc& desc() const { return m_desc; }
+
+    /**
+     * Allocate a block from the heap.
+     *
+     * \param size Size in bytes.
+     * \return New allocation.
+     */
+    ref<BufferHeapAllocation> allocate(size_t size);
+
+    /// Release pages that have no live or pending allocations.
+    void trim();
+
+    /// Get heap statistics.
+    BufferHeapStats stats() const;
+
+    std::string to_string() const override;
+
+private:
+    struct Page {
+        ref<Buffer> buffer;
+        uint32_t size_class;
+        /// Offset of the first block that has not been handed out yet.
+        DeviceOffset next_offset{0};
+        /// Number of live allocations in this page.
+        size_t live_blocks{0};
+    };
+
+    struct FreeBlock {
+        Page* page;
+        DeviceOffset offset;
+        uint64_t submit_id;
+    };
+
+    struct SizeClass {
+        size_t block_size;
+        /// Freed blocks, ordered by submit ID.
+        std::deque<FreeBlock> free_blocks;
+        /// Pages serving this size class, the last one is used for carving new blocks.
+        std::vector<std::unique_ptr<Page>> pages;
+    };
+
+    void release(Page* page, DeviceOffset offset, size_t size);
+
+    BufferHeapDesc m_desc;
+    std::vector<SizeClass> m_size_classes;
+    mutable std::mutex m_mutex;
+
+    size_t m_requested_size{0};
+    size_t m_allocated_size{0};
+    size_t m_allocation_count{0};
+    size_t m_dedicated_size{0};
+
+    /// Cached ID of the last submission known to have finished.
+    uint64_t m_completed_submit_id{0};
+
+    friend class BufferHeapAllocation;
+};
+
+/// A slice of a backing buffer handed out by a \c BufferHeap.
+/// The block is returned to the heap when the allocation is released.
+class SGL_API BufferHeapAllocation : public Object {
+    SGL_OBJECT(BufferHeapAllocation)
+public:
+    BufferHeapAllocation(
+        ref<BufferHeap> heap,
+        ref<Buffer> buffer,
+        DeviceOffset offset,
+        size_t size,
+        BufferHeap::Page* page
+    );
+    ~BufferHeapAllocation();
+
+    /// Backing buffer.
+    Buffer* buffer() const { return m_buffer; }
+
+    /// Offset of the allocation in the backing buffer.
+    DeviceOffset offset() const { return m_offset; }
+
+    /// Requested size in bytes.
+    size_t size() const { return m_size; }
+
+    /// Device address of the allocation.
+    DeviceAddress device_address() const { return m_buffer->device_address() + m_offset; }
+
+    /// Buffer and offset pair, for use in vertex/index buffer bindings and copies.
+    BufferOffsetPair buffer_offset_pair() const { return BufferOffsetPair(m_buffer, m_offset); }
+
+    /// Create a view of the allocation.
+    ref<BufferView> create_view(Format format = Format::undefined) const;
+
+    /// Set allocation data from host memory.
+    void set_data(const void* data, size_t size, DeviceOffset offset = 0);
+
+    /// Get allocation data to host memory.
+    void get_data(void* data, size_t size, DeviceOffset offset = 0);
+
+    std::string to_string() const override;
+
+private:
+    ref<BufferHeap> m_heap;
+    ref<Buffer> m_buffer;
+    DeviceOffset m_offset;
+    size_t m_size;
+    /// Page the block was carved from (nullptr for dedicated allocations).
+    BufferHeap::Page* m_page;
+};
+
+} // namespace sgl
@@ -14,6 +14,7 @@
 #include "sgl/device/cuda_interop.h"
 #include "sgl/device/shader_cursor.h"
 #include "sgl/device/print.h"
+#include "sgl/device/bindless.h"
 #include "sgl/device/blit.h"
 
 #include "sgl/core/short_vector.h"
@@ -22,6 +23,8 @@
 
 #include "sgl/math/vector.h"
 
+#include <cstring>
+
 namespace sgl {
 
 namespace detail {
@@ -101,9 +104,11 @@ ShaderObject* RenderPassEncoder::bind_pipeline(RenderPipeline* pipeline)
     SGL_CHECK_NOT_NULL(pipeline);
 
     rhi::IShaderObject* rhi_root_object = m_rhi_render_pass_encoder->bindPipeline(pipeline->rhi_pipeline());
-    ShaderObject* root_object = m_command_encoder->_get_root_object(rhi_root_object);
+    ShaderObject* root_object = m_command_encoder->_get_root_object(rhi_root_object, pipeline);
     if (m_command_encoder->device()->debug_printer())
         m_command_encoder->device()->debug_printer()->bind(ShaderCursor(root_object));
+    if (m_command_encoder->device()->bindless_table())
+        m_command_encoder->device()->bindless_table()->bind(ShaderCursor(root_object), pipeline->program());
     return root_object;
 }
 
@@ -184,9 +189,11 @@ ShaderObject* ComputePassEncoder::bind_pipeline(ComputePipeline* pipeline)
 
     m_thread_group_size = pipeline->thread_group_size();
     rhi::IShaderObject* rhi_root_object = m_rhi_compute_pass_encoder->bindPipeline(pipeline->rhi_pipeline());
-    ShaderObject* root_object = m_command_encoder->_get_root_object(rhi_root_object);
+    ShaderObject* root_object = m_command_encoder->_get_root_object(rhi_root_object, pipeline);
     if (m_command_encoder->device()->debug_printer())
         m_command_encoder->device()->debug_printer()->bind(ShaderCursor(root_object));
+    if (m_command_encoder->device()->bindless_table())
+        m_command_encoder->device()->bindless_table()->bind(ShaderCursor(root_object), pipeline->program());
     return root_object;
 }
 
@@ -234,9 +241,11 @@ ShaderObject* RayTracingPassEncoder::bind_pipeline(RayTracingPipeline* pipeline,
 
     rhi::IShaderObject* rhi_root_object
         = m_rhi_ray_tracing_pass_encoder->bindPipeline(pipeline->rhi_pipeline(), shader_table->rhi_shader_table());
-    ShaderObject* root_object = m_command_encoder->_get_root_object(rhi_root_object);
+    ShaderObject* root_object = m_command_encoder->_get_root_object(rhi_root_object, pipeline);
     if (m_command_encoder->device()->debug_printer())
         m_command_encoder->device()->debug_printer()->bind(ShaderCursor(root_object));
+    if (m_command_encoder->device()->bindless_table())
+        m_command_encoder->device()->bindless_table()->bind(ShaderCursor(root_object), pipeline->program());
     return root_object;
 }
 
@@ -269,15 +278,22 @@ void RayTracingPassEncoder::end()
 // CommandEncoder
 // ----------------------------------------------------------------------------
 
-CommandEncoder::CommandEncoder(ref<Device> device, Slang::ComPtr<rhi::ICommandEncoder> rhi_command_encoder)
+CommandEncoder::CommandEncoder(
+    ref<Device> device,
+    Slang::ComPtr<rhi::ICommandEncoder> rhi_command_encoder,
+    CommandQueueType queue
+)
     : DeviceResource(std::move(device))
     , m_rhi_command_encoder(std::move(rhi_command_encoder))
+    , m_queue(queue)
     , m_open(true)
 {
 }
 
 ref<RenderPassEncoder> CommandEncoder::begin_render_pass(const RenderPassDesc& desc)
 {
+    SGL_CHECK(m_queue == CommandQueueType::graphics, "Render passes require a graphics queue command encoder.");
+
     rhi::RenderPassDesc rhi_desc = {};
 
     short_vector<rhi::RenderPassColorAttachment, 16> rhi_color_attachments;
@@ -322,6 +338,8 @@ ref<RenderPassEncoder> CommandEncoder::begin_render_pass(const RenderPassDesc& d
 
 ref<ComputePassEncoder> CommandEncoder::begin_compute_pass()
 {
+    SGL_CHECK(m_queue != CommandQueueType::transfer, "Compute passes are not supported on the transfer queue.");
+
     if (!m_compute_pass_encoder) {
         m_compute_pass_encoder = make_ref<ComputePassEncoder>();
     }
@@ -334,6 +352,8 @@ ref<ComputePassEncoder> CommandEncoder::begin_compute_pass()
 
 ref<RayTracingPassEncoder> CommandEncoder::begin_ray_tracing_pass()
 {
+    SGL_CHECK(m_queue != CommandQueueType::transfer, "Ray tracing passes are not supported on the transfer queue.");
+
     if (!m_ray_tracing_pass_encoder) {
         m_ray_tracing_pass_encoder = make_ref<RayTracingPassEncoder>();
     }
@@ -344,9 +364,10 @@ ref<RayTracingPassEncoder> CommandEncoder::begin_ray_tracing_pass()
     return m_ray_tracing_pass_encoder;
 }
 
-ShaderObject* CommandEncoder::_get_root_object(rhi::IShaderObject* rhi_shader_object)
+ShaderObject* CommandEncoder::_get_root_object(rhi::IShaderObject* rhi_shader_object, const Pipeline* pipeline)
 {
-    m_root_object = make_ref<ShaderObject>(m_device, rhi_shader_object, false);
+    // Share the flattened type layouts of the program across the root objects of all passes.
+    m_root_object = make_ref<ShaderObject>(m_device, rhi_shader_object, false, pipeline->program()->_flat_layouts());
     return m_root_object.get();
 }
 
@@ -499,6 +520,37 @@ void CommandEncoder::copy_buffer_to_texture(
     );
 }
 
+ref<AsyncReadback> CommandEncoder::read_buffer_async(const Buffer* buffer, DeviceOffset offset, DeviceSize size)
+{
+    SGL_CHECK(m_open, "Command encoder is finished");
+    SGL_CHECK_NOT_NULL(buffer);
+    SGL_CHECK(offset + size <= buffer->size(), "Buffer read is out of bounds");
+
+    ref<Buffer> read_back_buffer = m_device->_acquire_read_back_buffer(size);
+    copy_buffer(read_back_buffer, 0, buffer, offset, size);
+
+    ref<AsyncReadback> readback = make_ref<AsyncReadback>(m_device, std::move(read_back_buffer), size);
+    m_readbacks.push_back(readback);
+    return readback;
+}
+
+ref<AsyncReadback> CommandEncoder::read_texture_async(const Texture* texture, uint32_t layer, uint32_t mip)
+{
+    SGL_CHECK(m_open, "Command encoder is finished");
+    SGL_CHECK_NOT_NULL(texture);
+    SGL_CHECK_LT(layer, texture->layer_count());
+    SGL_CHECK_LT(mip, texture->mip_count());
+
+    SubresourceLayout layout = texture->get_subresource_layout(mip);
+    ref<Buffer> read_back_buffer = m_device->_acquire_read_back_buffer(layout.size_in_bytes);
+    copy_texture_to_buffer(read_back_buffer, 0, layout.size_in_bytes, layout.row_pitch, texture, layer, mip);
+
+    ref<AsyncReadback> readback
+        = make_ref<AsyncReadback>(m_device, std::move(read_back_buffer), layout.size_in_bytes, layout);
+    m_readbacks.push_back(readback);
+    return readback;
+}
+
 void CommandEncoder::upload_buffer_data(Buffer* buffer, size_t offset, size_t size, const void* data)
 {
     SGL_CHECK(m_open, "Command encoder is finished");
@@ -822,7 +874,8 @@ ref<CommandBuffer> CommandEncoder::finish()
     SGL_CHECK(m_open, "Command encoder is finished");
     Slang::ComPtr<rhi::ICommandBuffer> rhi_command_buffer;
     SLANG_CALL(m_rhi_command_encoder->finish(rhi_command_buffer.writeRef()));
-    ref<CommandBuffer> command_buffer = make_ref<CommandBuffer>(m_device, rhi_command_buffer);
+    ref<CommandBuffer> command_buffer = make_ref<CommandBuffer>(m_device, rhi_command_buffer, m_queue);
+    command_buffer->m_readbacks = std::move(m_readbacks);
     m_open = false;
     return command_buffer;
 }
@@ -848,9 +901,14 @@ std::string CommandEncoder::to_string() const
 // CommandBuffer
 // ----------------------------------------------------------------------------
 
-CommandBuffer::CommandBuffer(ref<Device> device, Slang::ComPtr<rhi::ICommandBuffer> command_buffer)
+CommandBuffer::CommandBuffer(
+    ref<Device> device,
+    Slang::ComPtr<rhi::ICommandBuffer> command_buffer,
+    CommandQueueType queue
+)
     : DeviceResource(std::move(device))
     , m_rhi_command_buffer(std::move(command_buffer))
+    , m_queue(queue)
 {
 }
 
@@ -866,4 +924,72 @@ std::string CommandBuffer::to_string() const
     );
 }
 
+// ----------------------------------------------------------------------------
+// AsyncReadback
+// ----------------------------------------------------------------------------
+
+AsyncReadback::AsyncReadback(
+    ref<Device> device,
+    ref<Buffer> buffer,
+    size_t size,
+    std::optional<SubresourceLayout> layout
+)
+    : DeviceResource(std::move(device))
+    , m_buffer(std::move(buffer))
+    , m_size(size)
+    , m_layout(std::move(layout))
+{
+}
+
+AsyncReadback::~AsyncReadback()
+{
+    // Return the buffer to the pool. If never submitted, it is immediately reusable.
+    if (m_buffer) {
+        if (m_mapped_data)
+            m_buffer->unmap();
+        m_device->_release_read_back_buffer(std::move(m_buffer), m_submit_id);
+    }
+}
+
+bool AsyncReadback::is_ready() const
+{
+    return is_submitted() && m_device->is_submit_finished(m_submit_id);
+}
+
+void AsyncReadback::wait() const
+{
+    SGL_CHECK(is_submitted(), "Read back has not been submitted");
+    m_device->wait_for_submit(m_submit_id);
+}
+
+const void* AsyncReadback::data() const
+{
+    wait();
+    // Buffer stays mapped until the handle is released.
+    if (!m_mapped_data)
+        m_mapped_data = m_buffer->map();
+    return m_mapped_data;
+}
+
+void AsyncReadback::read(void* data, size_t size) const
+{
+    SGL_CHECK_NOT_NULL(data);
+    SGL_CHECK(size <= m_size, "Read size exceeds read back size ({} > {})", size, m_size);
+    std::memcpy(data, this->data(), size);
+}
+
+std::string AsyncReadback::to_string() const
+{
+    return fmt::format(
+        "AsyncReadback(\n"
+        "  device = {},\n"
+        "  size = {},\n"
+        "  submit_id = {}\n"
+        ")",
+        m_device,
+        m_size,
+        m_submit_id
+    );
+}
+
 } // namespace sgl
@@ -13,6 +13,7 @@
 #include "sgl/core/static_vector.h"
 #include "sgl/math/vector_types.h"
 
+#include <optional>
 #include <span>
 
 namespace sgl {
@@ -141,13 +142,20 @@ private:
 class SGL_API CommandEncoder : public DeviceResource {
     SGL_OBJECT(CommandEncoder)
 public:
-    CommandEncoder(ref<Device> device, Slang::ComPtr<rhi::ICommandEncoder> rhi_command_encoder);
+    CommandEncoder(
+        ref<Device> device,
+        Slang::ComPtr<rhi::ICommandEncoder> rhi_command_encoder,
+        CommandQueueType queue = CommandQueueType::graphics
+    );
+
+    /// Command queue this encoder records commands for.
+    CommandQueueType queue() const { return m_queue; }
 
     ref<RenderPassEncoder> begin_render_pass(const RenderPassDesc& desc);
     ref<ComputePassEncoder> begin_compute_pass();
     ref<RayTracingPassEncoder> begin_ray_tracing_pass();
 
-    ShaderObject* _get_root_object(rhi::IShaderObject* rhi_shader_object);
+    ShaderObject* _get_root_object(rhi::IShaderObject* rhi_shader_object, const Pipeline* pipeline);
 
     /**
      * \brief Copy a buffer region.
@@ -256,6 +264,34 @@ public:
         uint3 extent = uint3(-1)
     );
 
+    /**
+     * \brief Read back a buffer region asynchronously.
+     *
+     * Records a copy of the region into a pooled read back buffer. The returned handle
+     * becomes readable once the command buffer has been submitted and has finished
+     * executing, without blocking the submission.
+     *
+     * \param buffer Buffer to read from.
+     * \param offset Offset in bytes.
+     * \param size Size in bytes.
+     * \return Read back handle.
+     */
+    ref<AsyncReadback> read_buffer_async(const Buffer* buffer, DeviceOffset offset, DeviceSize size);
+
+    /**
+     * \brief Read back a texture subresource asynchronously.
+     *
+     * Records a copy of the subresource into a pooled read back buffer, using the
+     * layout returned by \c Texture::get_subresource_layout. The returned handle
+     * becomes readable once the command buffer has been submitted and has finished executing.
+     *
+     * \param texture Texture to read from.
+     * \param layer Layer index.
+     * \param mip Mip level.
+     * \return Read back handle.
+     */
+    ref<AsyncReadback> read_texture_async(const Texture* texture, uint32_t layer, uint32_t mip);
+
     /**
      * \brief Upload host memory to a buffer.
      *
@@ -394,9 +430,13 @@ public:
 
 private:
     Slang::ComPtr<rhi::ICommandEncoder> m_rhi_command_encoder;
+    CommandQueueType m_queue;
 
     std::vector<ref<cuda::InteropBuffer>> m_cuda_interop_buffers;
 
+    /// Read backs recorded into this encoder, handed to the command buffer on finish.
+    std::vector<ref<AsyncReadback>> m_readbacks;
+
     bool m_open{false};
 
     ref<RenderPassEncoder> m_render_pass_encoder;
@@ -408,19 +448,77 @@ private:
 class SGL_API CommandBuffer : public DeviceResource {
     SGL_OBJECT(CommandBuffer)
 public:
-    CommandBuffer(ref<Device> device, Slang::ComPtr<rhi::ICommandBuffer> rhi_command_buffer);
+    CommandBuffer(
+        ref<Device> device,
+        Slang::ComPtr<rhi::ICommandBuffer> rhi_command_buffer,
+        CommandQueueType queue = CommandQueueType::graphics
+    );
     ~CommandBuffer();
 
+    /// Command queue this command buffer must be submitted to.
+    CommandQueueType queue() const { return m_queue; }
+
     rhi::ICommandBuffer* rhi_command_buffer() const { return m_rhi_command_buffer; }
 
     std::string to_string() const override;
 
 private:
     Slang::ComPtr<rhi::ICommandBuffer> m_rhi_command_buffer;
+    CommandQueueType m_queue;
 
     std::vector<ref<cuda::InteropBuffer>> m_cuda_interop_buffers;
 
+    /// Read backs recorded into this command buffer, assigned a submit ID on submission.
+    std::vector<ref<AsyncReadback>> m_readbacks;
+
+    friend class CommandEncoder;
     friend class Device;
 };
 
+/// Handle to an asynchronous read back, created by \c CommandEncoder::read_buffer_async
+/// or \c CommandEncoder::read_texture_async. The data is held in a pooled read back
+/// buffer, which is returned to the device pool when the handle is released.
+class SGL_API AsyncReadback : public DeviceResource {
+    SGL_OBJECT(AsyncReadback)
+public:
+    AsyncReadback(ref<Device> device, ref<Buffer> buffer, size_t size, std::optional<SubresourceLayout> layout = {});
+    ~AsyncReadback();
+
+    /// Size of the read back data in bytes.
+    size_t size() const { return m_size; }
+
+    /// Subresource layout of the data (texture read backs only).
+    const std::optional<SubresourceLayout>& layout() const { return m_layout; }
+
+    /// True if the command buffer containing the read back has been submitted.
+    bool is_submitted() const { return m_submit_id != 0; }
+
+    /// Submit ID of the command buffer containing the read back (0 if not yet submitted).
+    uint64_t submit_id() const { return m_submit_id; }
+
+    /// True if the read back has finished and the data can be accessed without blocking.
+    bool is_ready() const;
+
+    /// Wait for the read back to finish.
+    void wait() const;
+
+    /// Get a pointer to the read back data. Waits for the read back to finish.
+    const void* data() const;
+
+    /// Copy the read back data to host memory. Waits for the read back to finish.
+    void read(void* data, size_t size) const;
+
+    /// Called by the device on submission.
+    void _set_submit_id(uint64_t submit_id) { m_submit_id = submit_id; }
+
+    std::string to_string() const override;
+
+private:
+    ref<Buffer> m_buffer;
+    size_t m_size;
+    std::optional<SubresourceLayout> m_layout;
+    uint64_t m_submit_id{0};
+    mutable const void* m_mapped_data{nullptr};
+};
+
 } // namespace sgl
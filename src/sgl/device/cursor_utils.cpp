@@ -78,121 +78,113 @@ namespace cursor_utils {
     }
 
     void check_array(
-        slang::TypeLayoutReflection* type_layout,
+        const FlatTypeLayout* layout,
         size_t size,
         TypeReflection::ScalarType scalar_type,
         size_t element_count
     )
     {
-        slang::TypeReflection* type = type_layout->getType();
-        slang::TypeReflection* element_type = unwrap_array(type_layout)->getType();
-        size_t element_size = get_scalar_type_size((TypeReflection::ScalarType)element_type->getScalarType());
+        size_t element_size = get_scalar_type_size(layout->leaf_scalar_type);
 
-        SGL_CHECK(type->isArray(), "\"{}\" cannot bind an array", type_layout->getName());
         SGL_CHECK(
-            allow_scalar_conversion(scalar_type, (TypeReflection::ScalarType)element_type->getScalarType()),
+            layout->kind == TypeReflection::Kind::array,
+            "\"{}\" cannot bind an array",
+            layout->type_layout->getName()
+        );
+        SGL_CHECK(
+            allow_scalar_conversion(scalar_type, layout->leaf_scalar_type),
             "\"{}\" expects scalar type {} (no implicit conversion from type {})",
-            type_layout->getName(),
-            (TypeReflection::ScalarType)element_type->getScalarType(),
+            layout->type_layout->getName(),
+            layout->leaf_scalar_type,
             scalar_type
         );
         SGL_CHECK(
-            element_count <= type->getElementCount(),
+            element_count <= layout->element_count,
             "\"{}\" expects an array with at most {} elements (got {})",
-            type_layout->getName(),
-            type->getElementCount(),
+            layout->type_layout->getName(),
+            layout->element_count,
             element_count
         );
         SGL_ASSERT(element_count * element_size == size);
     }
 
-    void check_scalar(slang::TypeLayoutReflection* type_layout, size_t size, TypeReflection::ScalarType scalar_type)
+    void check_scalar(const FlatTypeLayout* layout, size_t size, TypeReflection::ScalarType scalar_type)
     {
-        slang::TypeReflection* type = unwrap_array(type_layout)->getType();
-
         SGL_CHECK(
-            (TypeReflection::Kind)type->getKind() == TypeReflection::Kind::scalar,
+            layout->leaf_kind == TypeReflection::Kind::scalar,
             "\"{}\" cannot bind a scalar value",
-            type_layout->getName()
+            layout->type_layout->getName()
         );
         SGL_CHECK(
-            allow_scalar_conversion(scalar_type, (TypeReflection::ScalarType)type->getScalarType()),
+            allow_scalar_conversion(scalar_type, layout->leaf_scalar_type),
             "\"{}\" expects scalar type {} (no implicit conversion from type {})",
-            type_layout->getName(),
-            (TypeReflection::ScalarType)type->getScalarType(),
+            layout->type_layout->getName(),
+            layout->leaf_scalar_type,
             scalar_type
         );
         SGL_UNUSED(size);
     }
 
-    void check_vector(
-        slang::TypeLayoutReflection* type_layout,
-        size_t size,
-        TypeReflection::ScalarType scalar_type,
-        int dimension
-    )
+    void check_vector(const FlatTypeLayout* layout, size_t size, TypeReflection::ScalarType scalar_type, int dimension)
     {
-        slang::TypeReflection* type = unwrap_array(type_layout)->getType();
-
         SGL_CHECK(
-            (TypeReflection::Kind)type->getKind() == TypeReflection::Kind::vector,
+            layout->leaf_kind == TypeReflection::Kind::vector,
             "\"{}\" cannot bind a vector value",
-            type_layout->getName()
+            layout->type_layout->getName()
         );
         SGL_CHECK(
-            type->getColumnCount() == uint32_t(dimension),
+            layout->leaf_col_count == uint32_t(dimension),
             "\"{}\" expects a vector with dimension {} (got dimension {})",
-            type_layout->getName(),
-            type->getColumnCount(),
+            layout->type_layout->getName(),
+            layout->leaf_col_count,
             dimension
         );
         SGL_CHECK(
-            allow_scalar_conversion(scalar_type, (TypeReflection::ScalarType)type->getScalarType()),
+            allow_scalar_conversion(scalar_type, layout->leaf_scalar_type),
             "\"{}\" expects a vector with scalar type {} (no implicit conversion from type {})",
-            type_layout->getName(),
-            (TypeReflection::ScalarType)type->getScalarType(),
+            layout->type_layout->getName(),
+            layout->leaf_scalar_type,
             scalar_type
         );
         SGL_UNUSED(size);
     }
 
     void check_matrix(
-        slang::TypeLayoutReflection* type_layout,
+        const FlatTypeLayout* layout,
         size_t size,
         TypeReflection::ScalarType scalar_type,
         int rows,
         int cols
     )
     {
-        slang::TypeReflection* type = unwrap_array(type_layout)->getType();
-
         SGL_CHECK(
-            (TypeReflection::Kind)type->getKind() == TypeReflection::Kind::matrix,
+            layout->leaf_kind == TypeReflection::Kind::matrix,
             "\"{}\" cannot bind a matrix value",
-            type_layout->getName()
+            layout->type_layout->getName()
         );
 
+        uint32_t row_count = layout->leaf_row_count;
+        uint32_t col_count = layout->leaf_col_count;
 #if SGL_MACOS
-        bool dimensionCondition
-            = type->getRowCount() == uint32_t(rows) && (type->getColumnCount() == 2 ? cols == 2 : cols == 4);
+        bool dimensionCondition = row_count == uint32_t(rows) && (col_count == 2 ? cols == 2 : cols == 4);
 #else
-        bool dimensionCondition = type->getRowCount() == uint32_t(rows) && type->getColumnCount() == uint32_t(cols);
+        bool dimensionCondition = row_count == uint32_t(rows) && col_count == uint32_t(cols);
 #endif
 
         SGL_CHECK(
             dimensionCondition,
             "\"{}\" expects a matrix with dimension {}x{} (got dimension {}x{})",
-            type_layout->getName(),
-            type->getRowCount(),
-            type->getColumnCount(),
+            layout->type_layout->getName(),
+            row_count,
+            col_count,
             rows,
             cols
         );
         SGL_CHECK(
-            allow_scalar_conversion(scalar_type, (TypeReflection::ScalarType)type->getScalarType()),
+            allow_scalar_conversion(scalar_type, layout->leaf_scalar_type),
             "\"{}\" expects a matrix with scalar type {} (no implicit conversion from type {})",
-            type_layout->getName(),
-            (TypeReflection::ScalarType)type->getScalarType(),
+            layout->type_layout->getName(),
+            layout->leaf_scalar_type,
             scalar_type
         );
         SGL_UNUSED(size);
@@ -3,31 +3,109 @@
 #include "sgl/device/fwd.h"
 #include "sgl/device/reflection.h"
 
+#include "sgl/core/macros.h"
+
+#include "sgl/math/vector_types.h"
+#include "sgl/math/matrix_types.h"
+
+#include <atomic>
+
+/// Run cursor type checks on every write instead of once per field type and host value type.
+/// This also enables the checks for \c set_unchecked. Defined by the build system.
+#ifndef SGL_ENABLE_CURSOR_DEBUG_CHECKS
+#define SGL_ENABLE_CURSOR_DEBUG_CHECKS 0
+#endif
+
 namespace sgl {
 
+/// Describes a host value type that can be written through cursors without conversion.
+template<typename T>
+struct CursorValueTraits;
+
+#define SGL_CURSOR_VALUE_SCALAR(type, scalar_type_)                                                                    \
+    template<>                                                                                                         \
+    struct CursorValueTraits<type> {                                                                                   \
+        static constexpr TypeReflection::Kind kind = TypeReflection::Kind::scalar;                                     \
+        static constexpr TypeReflection::ScalarType scalar_type = TypeReflection::ScalarType::scalar_type_;            \
+        static constexpr int rows = 1;                                                                                 \
+        static constexpr int cols = 1;                                                                                 \
+    };
+
+SGL_CURSOR_VALUE_SCALAR(int8_t, int8);
+SGL_CURSOR_VALUE_SCALAR(uint8_t, uint8);
+SGL_CURSOR_VALUE_SCALAR(int16_t, int16);
+SGL_CURSOR_VALUE_SCALAR(uint16_t, uint16);
+SGL_CURSOR_VALUE_SCALAR(int32_t, int32);
+SGL_CURSOR_VALUE_SCALAR(uint32_t, uint32);
+SGL_CURSOR_VALUE_SCALAR(int64_t, int64);
+SGL_CURSOR_VALUE_SCALAR(uint64_t, uint64);
+SGL_CURSOR_VALUE_SCALAR(float16_t, float16);
+SGL_CURSOR_VALUE_SCALAR(float, float32);
+SGL_CURSOR_VALUE_SCALAR(double, float64);
+
+#undef SGL_CURSOR_VALUE_SCALAR
+
+template<typename T, int N>
+struct CursorValueTraits<math::vector<T, N>> {
+    static constexpr TypeReflection::Kind kind = TypeReflection::Kind::vector;
+    static constexpr TypeReflection::ScalarType scalar_type = CursorValueTraits<T>::scalar_type;
+    static constexpr int rows = 1;
+    static constexpr int cols = N;
+};
+
+template<typename T, int R, int C>
+struct CursorValueTraits<math::matrix<T, R, C>> {
+    static constexpr TypeReflection::Kind kind = TypeReflection::Kind::matrix;
+    static constexpr TypeReflection::ScalarType scalar_type = CursorValueTraits<T>::scalar_type;
+    static constexpr int rows = R;
+    static constexpr int cols = C;
+};
+
 namespace cursor_utils {
+    /// Pack the description of a host value type into a key for \c check_cached. Never returns 0.
+    inline uint64_t value_type_key(
+        TypeReflection::Kind kind,
+        TypeReflection::ScalarType scalar_type,
+        int rows,
+        int cols,
+        size_t size
+    )
+    {
+        return (uint64_t(size) << 32) | (uint64_t(kind) << 24) | (uint64_t(scalar_type) << 16) | (uint64_t(rows) << 8)
+            | uint64_t(cols);
+    }
+
+    /// Run the type checks \c check for writing a host value type to \c layout, unless the same
+    /// value type (identified by \c key) already passed them. With SGL_ENABLE_CURSOR_DEBUG_CHECKS,
+    /// the checks run on every call.
+    template<typename Check>
+    inline void check_cached(const FlatTypeLayout* layout, uint64_t key, Check&& check)
+    {
+#if SGL_ENABLE_CURSOR_DEBUG_CHECKS
+        SGL_UNUSED(layout, key);
+        check();
+#else
+        if (layout->checked_value_type.load(std::memory_order_relaxed) == key)
+            return;
+        check();
+        layout->checked_value_type.store(key, std::memory_order_relaxed);
+#endif
+    }
+
     size_t get_scalar_type_size(TypeReflection::ScalarType type);
 
     slang::TypeLayoutReflection* unwrap_array(slang::TypeLayoutReflection* layout);
 
     void check_array(
-        slang::TypeLayoutReflection* type_layout,
+        const FlatTypeLayout* layout,
         size_t size,
         TypeReflection::ScalarType scalar_type,
         size_t element_count
     );
-
-    void check_scalar(slang::TypeLayoutReflection* type_layout, size_t size, TypeReflection::ScalarType scalar_type);
-
-    void check_vector(
-        slang::TypeLayoutReflection* type_layout,
-        size_t size,
-        TypeReflection::ScalarType scalar_type,
-        int dimension
-    );
-
+    void check_scalar(const FlatTypeLayout* layout, size_t size, TypeReflection::ScalarType scalar_type);
+    void check_vector(const FlatTypeLayout* layout, size_t size, TypeReflection::ScalarType scalar_type, int dimension);
     void check_matrix(
-        slang::TypeLayoutReflection* type_layout,
+        const FlatTypeLayout* layout,
         size_t size,
         TypeReflection::ScalarType scalar_type,
         int rows,
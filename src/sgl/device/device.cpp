@@ -4,6 +4,8 @@
 
 #include "sgl/device/surface.h"
 #include "sgl/device/resource.h"
+#include "sgl/device/buffer_heap.h"
+#include "sgl/device/transient_resource_pool.h"
 #include "sgl/device/sampler.h"
 #include "sgl/device/fence.h"
 #include "sgl/device/query.h"
@@ -19,6 +21,7 @@
 #include "sgl/device/cuda_utils.h"
 #include "sgl/device/cuda_interop.h"
 #include "sgl/device/print.h"
+#include "sgl/device/bindless.h"
 #include "sgl/device/blit.h"
 #include "sgl/device/hot_reload.h"
 
@@ -27,6 +30,7 @@
 #include "sgl/core/error.h"
 #include "sgl/core/window.h"
 #include "sgl/core/string.h"
+#include "sgl/core/thread.h"
 
 #if SGL_HAS_D3D12
 #include <dxgi.h>
@@ -34,6 +38,8 @@
 #include <comdef.h>
 #endif
 
+#include <algorithm>
+#include <bit>
 #include <mutex>
 
 namespace sgl {
@@ -237,6 +243,10 @@ Device::Device(const DeviceDesc& desc)
     // Create global fence to synchronize command submission.
     m_global_fence = create_fence({.shared = m_desc.enable_cuda_interop});
 
+    // Create fences for cross-queue synchronization.
+    for (QueueState& queue_state : m_queues)
+        queue_state.fence = create_fence({});
+
     // Setup CUDA interop.
     if (m_desc.enable_cuda_interop) {
         SGL_CHECK(rhiCudaDriverApiInit(), "Failed to initialize CUDA driver API.");
@@ -248,6 +258,9 @@ Device::Device(const DeviceDesc& desc)
     if (m_desc.enable_print)
         m_debug_printer = std::make_unique<DebugPrinter>(this);
 
+    if (m_desc.enable_bindless)
+        m_bindless_table = make_ref<BindlessResourceTable>(this, m_desc.bindless_desc);
+
     // Add device to global device list.
     {
         std::lock_guard lock(s_devices_mutex);
@@ -315,7 +328,29 @@ void Device::close()
 
     m_blitter.reset();
     m_debug_printer.reset();
+    m_bindless_table.reset();
+
+    m_upload_encoder.reset();
+    m_pending_upload_size = 0;
+
+    {
+        std::lock_guard lock(m_read_back_pool_mutex);
+        m_read_back_pool.clear();
+    }
+
+    {
+        std::deque<DeferredRelease> released;
+        {
+            std::lock_guard lock(m_deferred_release_mutex);
+            released.swap(m_deferred_releases);
+        }
+        for (const DeferredRelease& release : released)
+            if (release.memory)
+                m_memory_tracker.untrack(*release.memory);
+    }
 
+    for (QueueState& queue_state : m_queues)
+        queue_state.fence.reset();
     m_global_fence.reset();
 
     m_slang_session.reset();
@@ -356,6 +391,16 @@ ref<BufferView> Device::create_buffer_view(Buffer* buffer, BufferViewDesc desc)
     return make_ref<BufferView>(ref<Device>(this), ref<Buffer>(buffer), std::move(desc));
 }
 
+ref<BufferHeap> Device::create_buffer_heap(BufferHeapDesc desc)
+{
+    return make_ref<BufferHeap>(ref<Device>(this), std::move(desc));
+}
+
+ref<TransientResourcePool> Device::create_transient_resource_pool(TransientResourcePoolDesc desc)
+{
+    return make_ref<TransientResourcePool>(ref<Device>(this), std::move(desc));
+}
+
 ref<Texture> Device::create_texture(TextureDesc desc)
 {
     return make_ref<Texture>(ref<Device>(this), std::move(desc));
@@ -437,8 +482,10 @@ ref<SlangSession> Device::create_slang_session(SlangSessionDesc desc)
 
 void Device::reload_all_programs()
 {
-    if (m_hot_reload)
+    if (m_hot_reload) {
+        std::lock_guard lock(m_hot_reload_mutex);
         m_hot_reload->recreate_all_sessions();
+    }
 }
 
 ref<SlangModule> Device::load_module(std::string_view module_name)
@@ -480,11 +527,16 @@ ref<ShaderObject> Device::create_root_shader_object(const ShaderProgram* shader_
     SLANG_CALL(m_rhi_device->createRootShaderObject(shader_program->rhi_shader_program(), rhi_shader_object.writeRef())
     );
 
-    ref<ShaderObject> shader_object = make_ref<ShaderObject>(ref<Device>(this), rhi_shader_object);
+    ref<ShaderObject> shader_object
+        = make_ref<ShaderObject>(ref<Device>(this), rhi_shader_object, true, shader_program->_flat_layouts());
+    slang::TypeLayoutReflection* type_layout = shader_object->slang_element_type_layout();
+    shader_object->_track_memory(type_layout ? type_layout->getSize() : 0);
 
     // Bind the debug printer to the new shader object, if enabled.
     if (m_debug_printer)
         m_debug_printer->bind(shader_object.get());
+    if (m_bindless_table)
+        m_bindless_table->bind(shader_object.get(), shader_program);
 
     return shader_object;
 }
@@ -497,7 +549,15 @@ ref<ShaderObject> Device::create_shader_object(const TypeLayoutReflection* type_
         rhi_shader_object.writeRef()
     ));
 
-    return make_ref<ShaderObject>(ref<Device>(this), rhi_shader_object);
+    // The cache keeps the type layout (and thereby the slang objects owning it) alive.
+    ref<ShaderObject> shader_object = make_ref<ShaderObject>(
+        ref<Device>(this),
+        rhi_shader_object,
+        true,
+        make_ref<FlatTypeLayoutCache>(ref<const Object>(type_layout))
+    );
+    shader_object->_track_memory(type_layout->size());
+    return shader_object;
 }
 
 ref<ShaderObject> Device::create_shader_object(ReflectionCursor cursor)
@@ -528,11 +588,12 @@ ref<ComputeKernel> Device::create_compute_kernel(ComputeKernelDesc desc)
 
 ref<CommandEncoder> Device::create_command_encoder(CommandQueueType queue)
 {
-    SGL_CHECK(queue == CommandQueueType::graphics, "Only graphics queue is supported.");
-
     Slang::ComPtr<rhi::ICommandEncoder> rhi_command_encoder;
-    SLANG_CALL(m_rhi_graphics_queue->createCommandEncoder(rhi_command_encoder.writeRef()));
-    return make_ref<CommandEncoder>(ref(this), rhi_command_encoder);
+    {
+        std::lock_guard lock(m_queue_mutex);
+        SLANG_CALL(get_rhi_queue(queue)->createCommandEncoder(rhi_command_encoder.writeRef()));
+    }
+    return make_ref<CommandEncoder>(ref(this), rhi_command_encoder, queue);
 }
 
 uint64_t Device::submit_command_buffers(
@@ -544,7 +605,7 @@ uint64_t Device::submit_command_buffers(
     CommandQueueType queue
 )
 {
-    SGL_CHECK(queue == CommandQueueType::graphics, "Only graphics queue is supported.");
+    rhi::ICommandQueue* rhi_queue = get_rhi_queue(queue);
 
     bool has_wait_fence_values = wait_fence_values.size() > 0;
     bool has_signal_fence_values = signal_fence_values.size() > 0;
@@ -554,10 +615,32 @@ uint64_t Device::submit_command_buffers(
     if (has_signal_fence_values && signal_fence_values.size() != signal_fences.size())
         SGL_THROW("\"signal_fence_values\" size does not match \"signal_fences\" size.");
 
+    // Free destroyed resources incrementally to amortize the cost across submits.
+    static constexpr size_t MAX_DEFERRED_RELEASES_PER_SUBMIT = 64;
+    collect_deferred_releases(MAX_DEFERRED_RELEASES_PER_SUBMIT);
+
+    // Pending batched uploads are submitted before the command buffers, so the command buffers
+    // observe the same data as with unbatched uploads (which are submitted immediately).
+    ref<CommandBuffer> upload_command_buffer = take_pending_uploads();
+    short_vector<CommandBuffer*, 8> all_command_buffers;
+    if (upload_command_buffer)
+        all_command_buffers.push_back(upload_command_buffer);
+    for (CommandBuffer* command_buffer : command_buffers)
+        all_command_buffers.push_back(command_buffer);
+
     // Update hot reload system if created.
     // TODO(slang-rhi) need to make sure this is not too expensive.
-    if (m_hot_reload)
-        m_hot_reload->update();
+    // Submission may happen from multiple threads. Only one of them needs to poll for changes,
+    // so others skip the update instead of waiting for a potentially long reload.
+    if (m_hot_reload) {
+        std::unique_lock hot_reload_lock(m_hot_reload_mutex, std::try_to_lock);
+        if (hot_reload_lock.owns_lock())
+            m_hot_reload->update();
+    }
+
+    // Submission may happen from multiple threads (e.g. slangpy calls dispatched
+    // with the GIL released), so serialize access to the queue and global fence.
+    std::lock_guard lock(m_queue_mutex);
 
     // TODO make parameter
     void* cuda_stream = 0;
@@ -570,14 +653,20 @@ uint64_t Device::submit_command_buffers(
 
     bool needs_cuda_sync = false;
 
-    for (CommandBuffer* command_buffer : command_buffers) {
+    for (CommandBuffer* command_buffer : all_command_buffers) {
         SGL_CHECK_NOT_NULL(command_buffer);
+        SGL_CHECK(
+            command_buffer == upload_command_buffer || command_buffer->queue() == queue,
+            "Command buffer was recorded for the {} queue but submitted to the {} queue.",
+            command_buffer->queue(),
+            queue
+        );
         rhi_command_buffers.push_back(command_buffer->rhi_command_buffer());
     }
 
     // Handle CUDA interop.
     if (m_supports_cuda_interop) {
-        for (CommandBuffer* command_buffer : command_buffers) {
+        for (CommandBuffer* command_buffer : all_command_buffers) {
             for (const auto& buffer : command_buffer->m_cuda_interop_buffers) {
                 buffer->copy_from_cuda(cuda_stream);
                 needs_cuda_sync = true;
@@ -605,6 +694,24 @@ uint64_t Device::submit_command_buffers(
         rhi_wait_fence_values.push_back(m_global_fence->signaled_value());
     }
 
+    // Handle cross-queue waits. Each other queue's fence is signaled with the IDs of its
+    // submissions, so waiting for its last submission up to submit_id covers all earlier ones.
+    QueueState& queue_state = m_queues[queue];
+    if (queue_state.wait_submit_id > 0) {
+        for (size_t i = 0; i < m_queues.size(); ++i) {
+            if (i == size_t(queue))
+                continue;
+            QueueState& other = m_queues[i];
+            prune_finished_submits(other);
+            auto it = std::upper_bound(other.submit_ids.begin(), other.submit_ids.end(), queue_state.wait_submit_id);
+            if (it != other.submit_ids.begin()) {
+                rhi_wait_fences.push_back(other.fence->rhi_fence());
+                rhi_wait_fence_values.push_back(*std::prev(it));
+            }
+        }
+        queue_state.wait_submit_id = 0;
+    }
+
     // Handle passed in signal fences.
     for (size_t i = 0; i < signal_fences.size(); ++i) {
         Fence* fence = signal_fences[i];
@@ -616,9 +723,18 @@ uint64_t Device::submit_command_buffers(
         rhi_signal_fence_values.push_back(fence_value);
     }
 
-    // Handle signal for global fence.
+    // Handle signal for global fence and the queue fence.
+    uint64_t next_submit_id = m_global_fence->update_signaled_value();
     rhi_signal_fences.push_back(m_global_fence->rhi_fence());
-    rhi_signal_fence_values.push_back(m_global_fence->update_signaled_value());
+    rhi_signal_fence_values.push_back(next_submit_id);
+    rhi_signal_fences.push_back(queue_state.fence->rhi_fence());
+    rhi_signal_fence_values.push_back(queue_state.fence->update_signaled_value(next_submit_id));
+
+    // Bound the list of pending submissions of queues that are never waited on.
+    static constexpr size_t MAX_PENDING_SUBMIT_IDS = 64;
+    if (queue_state.submit_ids.size() >= MAX_PENDING_SUBMIT_IDS)
+        prune_finished_submits(queue_state);
+    queue_state.submit_ids.push_back(next_submit_id);
 
     // Handle actual submit.
     SGL_ASSERT(rhi_wait_fences.size() == rhi_wait_fence_values.size());
@@ -633,14 +749,22 @@ uint64_t Device::submit_command_buffers(
         .signalFenceValues = rhi_signal_fence_values.data(),
         .signalFenceCount = narrow_cast<uint32_t>(rhi_signal_fences.size()),
     };
-    SLANG_CALL(m_rhi_graphics_queue->submit(rhi_submit_desc));
+    SLANG_CALL(rhi_queue->submit(rhi_submit_desc));
     m_wait_global_fence = false;
 
+    // Associate async read backs with this submission.
+    uint64_t submit_id = m_global_fence->signaled_value();
+    for (CommandBuffer* command_buffer : all_command_buffers) {
+        for (const auto& readback : command_buffer->m_readbacks)
+            readback->_set_submit_id(submit_id);
+        command_buffer->m_readbacks.clear();
+    }
+
     // Handle CUDA interop.
     if (m_supports_cuda_interop && needs_cuda_sync) {
         sync_to_device(cuda_stream);
 
-        for (CommandBuffer* command_buffer : command_buffers) {
+        for (CommandBuffer* command_buffer : all_command_buffers) {
             for (const auto& buffer : command_buffer->m_cuda_interop_buffers) {
                 if (buffer->is_uav())
                     buffer->copy_to_cuda(cuda_stream);
@@ -648,7 +772,7 @@ uint64_t Device::submit_command_buffers(
         }
     }
 
-    return m_global_fence->signaled_value();
+    return submit_id;
 }
 
 uint64_t Device::submit_command_buffer(CommandBuffer* command_buffer, CommandQueueType queue)
@@ -657,6 +781,48 @@ uint64_t Device::submit_command_buffer(CommandBuffer* command_buffer, CommandQue
     return submit_command_buffers(command_buffers, {}, {}, {}, {}, queue);
 }
 
+std::vector<ref<CommandBuffer>>
+Device::record_parallel(std::span<const RecordCommandsCallback> callbacks, CommandQueueType queue)
+{
+    std::vector<std::future<ref<CommandBuffer>>> futures;
+    futures.reserve(callbacks.size());
+    for (const RecordCommandsCallback& callback : callbacks) {
+        futures.push_back(thread::do_async(
+            [this, &callback, queue]()
+            {
+                ref<CommandEncoder> command_encoder = create_command_encoder(queue);
+                callback(command_encoder);
+                return command_encoder->finish();
+            }
+        ));
+    }
+
+    // Wait for all tasks before propagating the first error, as tasks reference the callbacks.
+    std::vector<ref<CommandBuffer>> command_buffers(callbacks.size());
+    std::exception_ptr error;
+    for (size_t i = 0; i < futures.size(); ++i) {
+        try {
+            command_buffers[i] = futures[i].get();
+        } catch (...) {
+            if (!error)
+                error = std::current_exception();
+        }
+    }
+    if (error)
+        std::rethrow_exception(error);
+
+    return command_buffers;
+}
+
+uint64_t Device::submit_parallel(std::span<const RecordCommandsCallback> callbacks, CommandQueueType queue)
+{
+    std::vector<ref<CommandBuffer>> command_buffers = record_parallel(callbacks, queue);
+    std::vector<CommandBuffer*> command_buffer_ptrs(command_buffers.size());
+    for (size_t i = 0; i < command_buffers.size(); ++i)
+        command_buffer_ptrs[i] = command_buffers[i];
+    return submit_command_buffers(command_buffer_ptrs, {}, {}, {}, {}, queue);
+}
+
 bool Device::is_submit_finished(uint64_t id)
 {
     return id <= m_global_fence->current_value();
@@ -667,10 +833,29 @@ void Device::wait_for_submit(uint64_t id)
     m_global_fence->wait(id);
 }
 
+uint64_t Device::last_submit_id() const
+{
+    return m_global_fence->signaled_value();
+}
+
+void Device::queue_wait_for_submit(CommandQueueType queue, uint64_t submit_id)
+{
+    get_rhi_queue(queue);
+    SGL_CHECK(submit_id <= last_submit_id(), "Submission {} has not been submitted yet.", submit_id);
+    std::lock_guard lock(m_queue_mutex);
+    uint64_t& wait_submit_id = m_queues[queue].wait_submit_id;
+    wait_submit_id = std::max(wait_submit_id, submit_id);
+}
+
 void Device::wait_for_idle(CommandQueueType queue)
 {
-    SGL_CHECK(queue == CommandQueueType::graphics, "Only graphics queue is supported.");
-    m_rhi_graphics_queue->waitOnHost();
+    rhi::ICommandQueue* rhi_queue = get_rhi_queue(queue);
+    flush_uploads();
+    {
+        std::lock_guard lock(m_queue_mutex);
+        rhi_queue->waitOnHost();
+    }
+    collect_deferred_releases();
 }
 
 void Device::sync_to_cuda(void* cuda_stream)
@@ -704,8 +889,148 @@ void Device::wait()
     wait_for_idle();
 }
 
+ref<Buffer> Device::_acquire_read_back_buffer(size_t size)
+{
+    // Read back buffers are allocated in power of two size classes (min 64KB) to improve reuse.
+    size_t alloc_size = std::max(size_t(64 * 1024), std::bit_ceil(size));
+
+    {
+        std::lock_guard lock(m_read_back_pool_mutex);
+        for (auto it = m_read_back_pool.begin(); it != m_read_back_pool.end(); ++it) {
+            if (it->buffer->size() == alloc_size && is_submit_finished(it->submit_id)) {
+                ref<Buffer> buffer = std::move(it->buffer);
+                m_read_back_pool.erase(it);
+                return buffer;
+            }
+        }
+    }
+
+    return create_buffer({
+        .size = alloc_size,
+        .memory_type = MemoryType::read_back,
+        .persistent_map = true,
+        .usage = BufferUsage::copy_destination,
+        .label = "read_back_pool",
+    });
+}
+
+void Device::_release_read_back_buffer(ref<Buffer> buffer, uint64_t submit_id)
+{
+    // Limit the number of pooled buffers, dropping the oldest ones.
+    static constexpr size_t MAX_POOLED_READ_BACK_BUFFERS = 32;
+
+    std::lock_guard lock(m_read_back_pool_mutex);
+    if (m_closed)
+        return;
+    if (m_read_back_pool.size() >= MAX_POOLED_READ_BACK_BUFFERS)
+        m_read_back_pool.erase(m_read_back_pool.begin());
+    m_read_back_pool.push_back({std::move(buffer), submit_id});
+}
+
+size_t Device::collect_deferred_releases(size_t max_count)
+{
+    std::vector<DeferredRelease> released;
+    {
+        std::lock_guard lock(m_deferred_release_mutex);
+        if (m_deferred_releases.empty() || !m_global_fence)
+            return 0;
+        m_completed_submit_id = m_global_fence->current_value();
+        while (!m_deferred_releases.empty() && m_deferred_releases.front().submit_id <= m_completed_submit_id) {
+            if (max_count > 0 && released.size() >= max_count)
+                break;
+            released.push_back(std::move(m_deferred_releases.front()));
+            m_deferred_releases.pop_front();
+        }
+    }
+    for (const DeferredRelease& release : released)
+        if (release.memory)
+            m_memory_tracker.untrack(*release.memory);
+    // Objects are released when going out of scope, outside of the lock.
+    return released.size();
+}
+
+size_t Device::deferred_release_count() const
+{
+    std::lock_guard lock(m_deferred_release_mutex);
+    return m_deferred_releases.size();
+}
+
+void Device::_deferred_release(ISlangUnknown* object, std::optional<TrackedMemory> memory)
+{
+    {
+        std::lock_guard lock(m_deferred_release_mutex);
+
+        // The device is idle once closed, so objects can be released immediately.
+        if (object && !m_closed && m_global_fence) {
+            // Only query the fence if the cached completed submit ID is not recent enough.
+            uint64_t submit_id = last_submit_id();
+            if (submit_id > m_completed_submit_id)
+                m_completed_submit_id = m_global_fence->current_value();
+            if (submit_id > m_completed_submit_id) {
+                // Submit IDs are monotonic, so the queue stays ordered.
+                m_deferred_releases.push_back({Slang::ComPtr<ISlangUnknown>(object), submit_id, std::move(memory)});
+                return;
+            }
+        }
+    }
+
+    // Released immediately by the caller.
+    if (memory)
+        m_memory_tracker.untrack(*memory);
+}
+
+void Device::flush_uploads()
+{
+    {
+        std::lock_guard lock(m_upload_mutex);
+        if (!m_upload_encoder)
+            return;
+    }
+    // Submitting an empty list picks up the pending uploads.
+    submit_command_buffers({});
+}
+
+CommandEncoder* Device::get_upload_encoder()
+{
+    if (!m_upload_encoder)
+        m_upload_encoder = create_command_encoder(CommandQueueType::graphics);
+    return m_upload_encoder;
+}
+
+void Device::end_batched_upload(size_t size)
+{
+    bool needs_flush = false;
+    {
+        std::lock_guard lock(m_upload_mutex);
+        m_pending_upload_size += size;
+        needs_flush = m_pending_upload_size >= m_desc.upload_batch_size;
+    }
+    if (needs_flush)
+        flush_uploads();
+}
+
+ref<CommandBuffer> Device::take_pending_uploads()
+{
+    std::lock_guard lock(m_upload_mutex);
+    if (!m_upload_encoder)
+        return nullptr;
+    ref<CommandBuffer> command_buffer = m_upload_encoder->finish();
+    m_upload_encoder.reset();
+    m_pending_upload_size = 0;
+    return command_buffer;
+}
+
 void Device::upload_buffer_data(Buffer* buffer, size_t offset, size_t size, const void* data)
 {
+    if (m_desc.enable_upload_batching) {
+        {
+            std::lock_guard lock(m_upload_mutex);
+            get_upload_encoder()->upload_buffer_data(buffer, offset, size, data);
+        }
+        end_batched_upload(size);
+        return;
+    }
+
     auto command_encoder = create_command_encoder();
     command_encoder->upload_buffer_data(buffer, offset, size, data);
     submit_command_buffer(command_encoder->finish());
@@ -717,6 +1042,8 @@ void Device::read_buffer_data(const Buffer* buffer, void* data, size_t size, siz
     SGL_CHECK(offset + size <= buffer->size(), "Buffer read is out of bounds");
     SGL_CHECK_NOT_NULL(data);
 
+    flush_uploads();
+
     SLANG_CALL(m_rhi_device->readBuffer(buffer->rhi_buffer(), offset, size, data));
 }
 
@@ -728,6 +1055,18 @@ void Device::upload_texture_data(
     std::span<SubresourceData> subresource_data
 )
 {
+    if (m_desc.enable_upload_batching) {
+        size_t size = 0;
+        {
+            std::lock_guard lock(m_upload_mutex);
+            get_upload_encoder()->upload_texture_data(texture, subresource_range, offset, extent, subresource_data);
+        }
+        for (const SubresourceData& data : subresource_data)
+            size += data.size;
+        end_batched_upload(size);
+        return;
+    }
+
     ref<CommandEncoder> command_encoder = create_command_encoder();
     command_encoder->upload_texture_data(texture, subresource_range, offset, extent, subresource_data);
     submit_command_buffer(command_encoder->finish());
@@ -735,6 +1074,15 @@ void Device::upload_texture_data(
 
 void Device::upload_texture_data(Texture* texture, uint32_t layer, uint32_t mip, SubresourceData subresource_data)
 {
+    if (m_desc.enable_upload_batching) {
+        {
+            std::lock_guard lock(m_upload_mutex);
+            get_upload_encoder()->upload_texture_data(texture, layer, mip, subresource_data);
+        }
+        end_batched_upload(subresource_data.size);
+        return;
+    }
+
     ref<CommandEncoder> command_encoder = create_command_encoder();
     command_encoder->upload_texture_data(texture, layer, mip, subresource_data);
     submit_command_buffer(command_encoder->finish());
@@ -746,6 +1094,8 @@ OwnedSubresourceData Device::read_texture_data(const Texture* texture, uint32_t
     SGL_CHECK_LT(layer, texture->layer_count());
     SGL_CHECK_LT(mip, texture->mip_count());
 
+    flush_uploads();
+
     // TODO(slang-rhi) use readTexture function that takes data pointer instead of doing extra copy
     Slang::ComPtr<ISlangBlob> blob;
     rhi::SubresourceLayout rhi_layout;
@@ -767,6 +1117,56 @@ OwnedSubresourceData Device::read_texture_data(const Texture* texture, uint32_t
     return subresource_data;
 }
 
+void Device::read_texture_data(
+    const Texture* texture,
+    uint32_t layer,
+    uint32_t mip,
+    void* data,
+    size_t size,
+    size_t row_pitch
+)
+{
+    SGL_CHECK_NOT_NULL(texture);
+    SGL_CHECK_LT(layer, texture->layer_count());
+    SGL_CHECK_LT(mip, texture->mip_count());
+    SGL_CHECK_NOT_NULL(data);
+
+    // Destination row size is the tightly packed row size.
+    SubresourceLayout packed_layout = texture->get_subresource_layout(mip, 1);
+    size_t row_size = packed_layout.row_pitch;
+    if (row_pitch == 0)
+        row_pitch = row_size;
+    SGL_CHECK(row_pitch >= row_size, "Row pitch too small ({} < {})", row_pitch, row_size);
+    size_t slice_pitch = row_pitch * packed_layout.row_count;
+    size_t required_size = slice_pitch * packed_layout.size.z;
+    SGL_CHECK(size >= required_size, "Destination size too small ({} < {})", size, required_size);
+
+    flush_uploads();
+
+    // slang-rhi only reads textures into a blob, which is repacked into the destination below.
+    Slang::ComPtr<ISlangBlob> blob;
+    rhi::SubresourceLayout rhi_layout;
+    SLANG_CALL(m_rhi_device->readTexture(texture->rhi_texture(), layer, mip, blob.writeRef(), &rhi_layout));
+    SubresourceLayout layout = layout_from_rhilayout(rhi_layout);
+
+    const uint8_t* src = reinterpret_cast<const uint8_t*>(blob->getBufferPointer());
+    uint8_t* dst = reinterpret_cast<uint8_t*>(data);
+
+    // Fast path for matching layouts.
+    if (layout.row_pitch == row_pitch && layout.slice_pitch == slice_pitch) {
+        std::memcpy(dst, src, required_size);
+        return;
+    }
+
+    // Repack rows in a single pass.
+    for (uint32_t z = 0; z < layout.size.z; ++z) {
+        const uint8_t* src_slice = src + z * layout.slice_pitch;
+        uint8_t* dst_slice = dst + z * slice_pitch;
+        for (size_t y = 0; y < layout.row_count; ++y)
+            std::memcpy(dst_slice + y * row_pitch, src_slice + y * layout.row_pitch, row_size);
+    }
+}
+
 std::array<NativeHandle, 3> Device::native_handles() const
 {
     rhi::DeviceNativeHandles handles = {};
@@ -776,9 +1176,13 @@ std::array<NativeHandle, 3> Device::native_handles() const
 
 NativeHandle Device::get_native_command_queue_handle(CommandQueueType queue) const
 {
-    SGL_CHECK(queue == CommandQueueType::graphics, "Only graphics queue is supported.");
+    SGL_CHECK(
+        queue == CommandQueueType::graphics,
+        "The {} queue is emulated on the graphics queue and has no native handle.",
+        queue
+    );
     rhi::NativeHandle rhi_handle = {};
-    SLANG_CALL(m_rhi_graphics_queue->getNativeHandle(&rhi_handle));
+    SLANG_CALL(get_rhi_queue(queue)->getNativeHandle(&rhi_handle));
     return NativeHandle(rhi_handle);
 }
 
@@ -906,9 +1310,28 @@ std::string Device::to_string() const
 
 Blitter* Device::_blitter()
 {
+    std::lock_guard lock(m_blitter_mutex);
     if (!m_blitter)
         m_blitter = ref(new Blitter(this));
     return m_blitter;
 }
 
+void Device::prune_finished_submits(QueueState& queue_state)
+{
+    if (queue_state.submit_ids.empty())
+        return;
+    uint64_t completed = queue_state.fence->current_value();
+    while (!queue_state.submit_ids.empty() && queue_state.submit_ids.front() <= completed)
+        queue_state.submit_ids.pop_front();
+}
+
+rhi::ICommandQueue* Device::get_rhi_queue(CommandQueueType queue) const
+{
+    SGL_CHECK(size_t(queue) < m_queues.size(), "Invalid command queue type.");
+    // slang-rhi only exposes a single graphics queue, so compute and transfer queues are
+    // emulated on it. Work on emulated queues executes in submission order.
+    // Until real queues are available, the multi-queue API is documented as experimental.
+    return m_rhi_graphics_queue;
+}
+
 } // namespace sgl
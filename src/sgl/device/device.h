@@ -9,6 +9,8 @@
 #include "sgl/device/shader.h"
 #include "sgl/device/raytracing.h"
 #include "sgl/device/coopvec.h"
+#include "sgl/device/memory_tracker.h"
+#include "sgl/device/bindless.h"
 
 #include "sgl/core/fwd.h"
 #include "sgl/core/config.h"
@@ -21,7 +23,10 @@
 #include <slang-rhi.h>
 
 #include <array>
+#include <atomic>
+#include <deque>
 #include <filesystem>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <vector>
@@ -113,6 +118,25 @@ struct DeviceDesc {
     /// Path to the shader cache directory (optional).
     /// If a relative path is used, the cache is stored in the application data directory.
     std::optional<std::filesystem::path> shader_cache_path;
+
+    /// Enable batching of buffer and texture uploads.
+    /// When enabled, uploads via \c Device::upload_buffer_data and \c Device::upload_texture_data
+    /// (and therefore \c Buffer::set_data on device local buffers) are recorded into a shared
+    /// command encoder instead of being submitted one by one. Pending uploads are submitted
+    /// before the command buffers of the next submission, when waiting for the device or
+    /// reading back data, when the batch size threshold is exceeded, or explicitly with
+    /// \c Device::flush_uploads. Batched uploads are therefore observed by all subsequently
+    /// submitted work, exactly as if they were submitted immediately.
+    bool enable_upload_batching{false};
+
+    /// Size threshold (in bytes) at which pending batched uploads are flushed.
+    size_t upload_batch_size{64 * 1024 * 1024};
+
+    /// Enable the bindless resource table (see \c BindlessResourceTable).
+    bool enable_bindless{false};
+
+    /// Capacities of the bindless resource table.
+    BindlessResourceTableDesc bindless_desc;
 };
 
 struct DeviceLimits {
@@ -186,6 +210,9 @@ using ShaderHotReloadCallback = std::function<void(const ShaderHotReloadEvent&)>
 
 using DeviceCloseCallback = std::function<void(Device*)>;
 
+/// Callback recording commands into a command encoder (see \c Device::record_parallel).
+using RecordCommandsCallback = std::function<void(CommandEncoder*)>;
+
 class SGL_API Device : public Object {
     SGL_OBJECT(Device)
 public:
@@ -279,6 +306,26 @@ public:
 
     ref<BufferView> create_buffer_view(Buffer* buffer, BufferViewDesc desc);
 
+    /**
+     * \brief Create a new buffer heap for sub-allocating many small buffers.
+     *
+     * \param memory_type Memory type of the backing buffers.
+     * \param usage Resource usage flags of the backing buffers.
+     * \param page_size Size of each backing buffer (page) in bytes.
+     * \param min_block_size Smallest size class in bytes.
+     * \param label Debug label.
+     * \return New buffer heap object.
+     */
+    ref<BufferHeap> create_buffer_heap(BufferHeapDesc desc);
+
+    /**
+     * \brief Create a new pool for recycling transient textures and buffers.
+     *
+     * \param enable_aliasing Allow reusing resources released within the current submission.
+     * \return New transient resource pool object.
+     */
+    ref<TransientResourcePool> create_transient_resource_pool(TransientResourcePoolDesc desc);
+
     /**
      * \brief Create a new texture.
      *
@@ -416,6 +463,9 @@ public:
 
     ref<ComputeKernel> create_compute_kernel(ComputeKernelDesc desc);
 
+    /// Create a command encoder for the given queue.
+    /// This is thread-safe, but each encoder must only be used by one thread at a time.
+    /// \note Compute and transfer queues are experimental (see \c CommandQueueType).
     ref<CommandEncoder> create_command_encoder(CommandQueueType queue = CommandQueueType::graphics);
 
     /**
@@ -457,6 +507,39 @@ public:
      */
     uint64_t submit_command_buffer(CommandBuffer* command_buffer, CommandQueueType queue = CommandQueueType::graphics);
 
+    /**
+     * \brief Record command buffers in parallel on the global thread pool.
+     *
+     * Each callback is invoked on a worker thread with its own command encoder and must only
+     * record independent work. Shader compilation (including blit programs created on first use)
+     * is serialized device-wide, so programs should be created up front to avoid stalling the
+     * workers. Blocks until all callbacks have finished.
+     * Must not be called from a task running on the global thread pool.
+     *
+     * \param callbacks Callbacks recording commands.
+     * \param queue Command queue to record for.
+     * \return Command buffers, in the order of the callbacks.
+     */
+    std::vector<ref<CommandBuffer>> record_parallel(
+        std::span<const RecordCommandsCallback> callbacks,
+        CommandQueueType queue = CommandQueueType::graphics
+    );
+
+    /**
+     * \brief Record command buffers in parallel and submit them in order.
+     *
+     * Records the command buffers using \c record_parallel and submits them in a single
+     * submission, in the order of the callbacks.
+     *
+     * \param callbacks Callbacks recording commands.
+     * \param queue Command queue to submit to.
+     * \return Submission ID.
+     */
+    uint64_t submit_parallel(
+        std::span<const RecordCommandsCallback> callbacks,
+        CommandQueueType queue = CommandQueueType::graphics
+    );
+
     /**
      * \brief Check if a submission is finished executing.
      *
@@ -472,6 +555,24 @@ public:
      */
     void wait_for_submit(uint64_t id);
 
+    /// ID of the last submission (0 if nothing has been submitted yet).
+    uint64_t last_submit_id() const;
+
+    /**
+     * \brief Make a queue wait for work submitted to other queues.
+     *
+     * The next submission to \c queue waits on the device (without blocking the host) until all
+     * submissions to the other queues up to and including \c submit_id have finished.
+     * Submission IDs are shared across queues, so any ID returned by a submit can be passed.
+     *
+     * \note This API is experimental. All queues are currently emulated on the graphics queue,
+     * so the wait only orders submissions and does not enable concurrent execution.
+     *
+     * \param queue Command queue that waits.
+     * \param submit_id Submission ID to wait for.
+     */
+    void queue_wait_for_submit(CommandQueueType queue, uint64_t submit_id);
+
     /**
      * \brief Wait for the command queue to be idle.
      *
@@ -499,6 +600,9 @@ public:
 
     DebugPrinter* debug_printer() const { return m_debug_printer.get(); }
 
+    /// Bindless resource table (nullptr if not enabled).
+    BindlessResourceTable* bindless_table() const { return m_bindless_table.get(); }
+
     /// Block and flush all shader side debug print output.
     void flush_print();
 
@@ -508,6 +612,34 @@ public:
     /// Wait for all device work to complete.
     void wait();
 
+    /// Submit any pending batched uploads (see \c DeviceDesc::enable_upload_batching).
+    void flush_uploads();
+
+    /// Size in bytes of the currently pending batched uploads.
+    size_t pending_upload_size() const { return m_pending_upload_size.load(std::memory_order_relaxed); }
+
+    /**
+     * \brief Release objects from the deferred release queue.
+     *
+     * Destroyed buffers, textures and acceleration structures that may still be referenced
+     * by in-flight submissions are not freed immediately but put on a deferred release queue.
+     * Objects are freed once the submissions that were pending at the time of destruction have
+     * finished executing. The queue is processed incrementally on every submit and fully
+     * in \c wait_for_idle, so calling this explicitly is only needed to free memory earlier.
+     *
+     * Resources are not tracked per submission, so any object destroyed while a submission is
+     * pending is deferred, even if it was never used on the GPU. Each object stays queued only
+     * until the submissions pending at its destruction have finished (and the next collection),
+     * so the queue is bounded by the objects destroyed during the lifetime of those submissions.
+     *
+     * \param max_count Maximum number of objects to release (0 for no limit).
+     * \return Number of released objects.
+     */
+    size_t collect_deferred_releases(size_t max_count = 0);
+
+    /// Number of objects waiting on the deferred release queue.
+    size_t deferred_release_count() const;
+
     /**
      * Upload host memory to buffer.
      *
@@ -557,6 +689,28 @@ public:
      */
     OwnedSubresourceData read_texture_data(const Texture* texture, uint32_t layer, uint32_t mip);
 
+    /**
+     * Read texture data into caller provided host memory.
+     * The data is read back into a staging blob, from which rows are repacked to the destination
+     * row pitch in a single copy (no additional host allocation is made).
+     * \note This will wait until the data is copied back to host memory.
+     *
+     * \param texture Texture to read from.
+     * \param layer Layer index.
+     * \param mip Mip level.
+     * \param data Destination memory.
+     * \param size Size of the destination memory in bytes.
+     * \param row_pitch Destination row pitch in bytes (0 for tightly packed rows).
+     */
+    void read_texture_data(
+        const Texture* texture,
+        uint32_t layer,
+        uint32_t mip,
+        void* data,
+        size_t size,
+        size_t row_pitch = 0
+    );
+
     rhi::IDevice* rhi_device() const { return m_rhi_device; }
     rhi::ICommandQueue* rhi_graphics_queue() const { return m_rhi_graphics_queue; }
 
@@ -565,9 +719,14 @@ public:
     /// Get the native device handles.
     std::array<NativeHandle, 3> native_handles() const;
 
+    /// Memory tracker aggregating the memory usage of all live resources.
+    MemoryTracker& memory_tracker() { return m_memory_tracker; }
+    const MemoryTracker& memory_tracker() const { return m_memory_tracker; }
+
     /// Returns the native API handle for the command queue:
     /// - D3D12: ID3D12CommandQueue*
     /// - Vulkan: VkQueue (Vulkan)
+    /// Throws for the compute and transfer queues, which are emulated on the graphics queue.
     NativeHandle get_native_command_queue_handle(CommandQueueType queue = CommandQueueType::graphics) const;
 
 
@@ -614,6 +773,22 @@ public:
     Blitter* _blitter();
     HotReload* _hot_reload() { return m_hot_reload; }
 
+    /// Serializes shader compilation and linking across all slang sessions of the device,
+    /// as slang sessions are not thread-safe. Recursive, as compile functions call each other.
+    std::recursive_mutex& _shader_compile_mutex() { return m_shader_compile_mutex; }
+
+    /// Acquire a read back buffer of at least \c size bytes from the read back pool.
+    /// Used by \c CommandEncoder::read_buffer_async and \c CommandEncoder::read_texture_async.
+    ref<Buffer> _acquire_read_back_buffer(size_t size);
+
+    /// Return a read back buffer to the pool. It is reused once \c submit_id has finished.
+    void _release_read_back_buffer(ref<Buffer> buffer, uint64_t submit_id);
+
+    /// Release an rhi object of a destroyed resource once all pending submissions have finished.
+    /// Called from the destructors of resources that may be referenced by in-flight command buffers.
+    /// The resource's tracked memory (if any) is unregistered when the object is actually released.
+    void _deferred_release(ISlangUnknown* object, std::optional<TrackedMemory> memory = {});
+
     /// Called by hot reload system after reload occurs, to trigger the hooks.
     void _on_hot_reload()
     {
@@ -622,6 +797,9 @@ public:
     }
 
 private:
+    /// Declared first so that it outlives all resources owned by the device.
+    MemoryTracker m_memory_tracker;
+
     DeviceDesc m_desc;
     DeviceInfo m_info;
     ShaderModel m_supported_shader_model{ShaderModel::unknown};
@@ -641,7 +819,27 @@ private:
 
     ref<Fence> m_global_fence;
 
+    /// State of a logical command queue.
+    /// slang-rhi currently only exposes a graphics queue, so the compute and transfer queues
+    /// are emulated on it (see \c get_rhi_queue). Each queue has its own fence, signaled with
+    /// the submission ID of its last submission, used for cross-queue synchronization.
+    struct QueueState {
+        ref<Fence> fence;
+        /// Submission ID the next submission has to wait for (0 if none).
+        uint64_t wait_submit_id{0};
+        /// IDs of submissions to this queue that may not have finished yet, in ascending order.
+        std::deque<uint64_t> submit_ids;
+    };
+    std::array<QueueState, 3> m_queues;
+
+    /// Remove the IDs of finished submissions from \c QueueState::submit_ids.
+    static void prune_finished_submits(QueueState& queue_state);
+
+    /// Returns the rhi command queue executing work of a logical command queue.
+    rhi::ICommandQueue* get_rhi_queue(CommandQueueType queue) const;
+
     std::unique_ptr<DebugPrinter> m_debug_printer;
+    ref<BindlessResourceTable> m_bindless_table;
 
     /// List of callbacks for hot reload event
     std::vector<ShaderHotReloadCallback> m_shader_hot_reload_callbacks;
@@ -650,13 +848,55 @@ private:
     std::vector<DeviceCloseCallback> m_device_close_callbacks;
 
     ref<Blitter> m_blitter;
+    std::mutex m_blitter_mutex;
     ref<HotReload> m_hot_reload;
+    /// Serializes hot reload updates from concurrent submissions.
+    std::mutex m_hot_reload_mutex;
+    std::recursive_mutex m_shader_compile_mutex;
     ref<CoopVec> m_coop_vec;
 
     bool m_supports_cuda_interop{false};
     ref<cuda::Device> m_cuda_device;
     ref<cuda::ExternalSemaphore> m_cuda_semaphore;
     bool m_wait_global_fence{false};
+
+    /// Serializes access to the command queue, allowing command encoders to be
+    /// created and submitted from multiple threads.
+    std::mutex m_queue_mutex;
+
+    /// Pool of read back buffers for async read backs.
+    struct PooledReadBackBuffer {
+        ref<Buffer> buffer;
+        uint64_t submit_id;
+    };
+    std::vector<PooledReadBackBuffer> m_read_back_pool;
+    std::mutex m_read_back_pool_mutex;
+
+    /// Queue of rhi objects waiting for pending submissions to finish, ordered by submit ID.
+    struct DeferredRelease {
+        Slang::ComPtr<ISlangUnknown> object;
+        uint64_t submit_id;
+        std::optional<TrackedMemory> memory;
+    };
+    std::deque<DeferredRelease> m_deferred_releases;
+    /// Cached ID of the last submission known to be finished.
+    uint64_t m_completed_submit_id{0};
+    mutable std::mutex m_deferred_release_mutex;
+
+    /// Command encoder used to record batched uploads.
+    ref<CommandEncoder> m_upload_encoder;
+    std::atomic<size_t> m_pending_upload_size{0};
+    std::mutex m_upload_mutex;
+
+    /// Returns the command encoder for batched uploads, creating it if needed.
+    /// Must be called with \c m_upload_mutex locked.
+    CommandEncoder* get_upload_encoder();
+
+    /// Account for a batched upload and flush if the batch size threshold is exceeded.
+    void end_batched_upload(size_t size);
+
+    /// Finish and return pending batched uploads (or nullptr if there are none).
+    ref<CommandBuffer> take_pending_uploads();
 };
 
 } // namespace sgl
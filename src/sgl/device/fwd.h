@@ -67,6 +67,7 @@ class DeclReflectionChildList;
 class DeclReflectionIndexedChildList;
 class TypeReflection;
 class TypeReflectionFieldList;
+class FlatTypeLayoutCache;
 class TypeLayoutReflection;
 class TypeLayoutReflectionFieldList;
 class FunctionReflection;
@@ -101,6 +102,30 @@ class RayTracingPipeline;
 struct QueryPoolDesc;
 class QueryPool;
 
+// buffer_heap.h
+
+struct BufferHeapDesc;
+struct BufferHeapStats;
+class BufferHeap;
+class BufferHeapAllocation;
+
+// memory_tracker.h
+
+struct MemoryCategoryStats;
+struct MemoryBudgetEvent;
+class MemoryTracker;
+
+// bindless.h
+
+struct BindlessResourceTableDesc;
+class BindlessResourceTable;
+
+// transient_resource_pool.h
+
+struct TransientResourcePoolDesc;
+struct TransientResourcePoolStats;
+class TransientResourcePool;
+
 // raytracing.h
 
 struct AccelerationStructureDesc;
@@ -117,11 +142,13 @@ class RenderPassEncoder;
 class ComputePassEncoder;
 class RayTracingPassEncoder;
 class CommandBuffer;
+class AsyncReadback;
 
 // shader_cursor.h
 
 class ShaderCursor;
 class ShaderObject;
+class PersistentShaderObject;
 
 // input_layout.h
 
@@ -7,6 +7,7 @@
 #include "sgl/device/pipeline.h"
 #include "sgl/device/command.h"
 #include "sgl/device/shader_cursor.h"
+#include "sgl/device/shader_object.h"
 
 #include "sgl/core/maths.h"
 
@@ -34,12 +35,50 @@ ComputeKernel::ComputeKernel(ref<Device> device, ComputeKernelDesc desc)
 
 ComputePipeline* ComputeKernel::pipeline() const
 {
+    // Pipeline is created lazily, and kernels may be dispatched from multiple threads.
+    std::lock_guard lock(m_pipeline_mutex);
     if (!m_pipeline)
         m_pipeline = m_device->create_compute_pipeline({.program = m_program});
     return m_pipeline;
 }
 
 void ComputeKernel::dispatch(uint3 thread_count, BindVarsCallback bind_vars, CommandEncoder* command_encoder)
+{
+    dispatch_impl(
+        thread_count,
+        [&](ShaderObject* shader_object)
+        {
+            if (bind_vars)
+                bind_vars(ShaderCursor(shader_object));
+        },
+        command_encoder
+    );
+}
+
+ref<PersistentShaderObject> ComputeKernel::create_root_object() const
+{
+    return make_ref<PersistentShaderObject>(m_device->create_root_shader_object(m_program));
+}
+
+void ComputeKernel::dispatch(
+    uint3 thread_count,
+    const PersistentShaderObject* root_object,
+    CommandEncoder* command_encoder
+)
+{
+    SGL_CHECK_NOT_NULL(root_object);
+    dispatch_impl(
+        thread_count,
+        [&](ShaderObject* shader_object) { root_object->apply(shader_object); },
+        command_encoder
+    );
+}
+
+void ComputeKernel::dispatch_impl(
+    uint3 thread_count,
+    const std::function<void(ShaderObject*)>& bind,
+    CommandEncoder* command_encoder
+)
 {
     ref<CommandEncoder> temp_command_encoder;
     if (command_encoder == nullptr) {
@@ -50,8 +89,7 @@ void ComputeKernel::dispatch(uint3 thread_count, BindVarsCallback bind_vars, Com
     {
         auto pass_encoder = command_encoder->begin_compute_pass();
         ShaderObject* shader_object = pass_encoder->bind_pipeline(pipeline());
-        if (bind_vars)
-            bind_vars(ShaderCursor(shader_object));
+        bind(shader_object);
         pass_encoder->dispatch(thread_count);
         pass_encoder->end();
     }
@@ -72,6 +110,8 @@ RayTracingKernel::RayTracingKernel(ref<Device> device, ref<ShaderProgram> progra
 
 RayTracingPipeline* RayTracingKernel::pipeline() const
 {
+    // Pipeline is created lazily, and kernels may be dispatched from multiple threads.
+    std::lock_guard lock(m_pipeline_mutex);
     if (!m_pipeline)
         m_pipeline = m_device->create_ray_tracing_pipeline({.program = m_program});
     return m_pipeline;
@@ -10,6 +10,7 @@
 #include "sgl/core/object.h"
 
 #include <functional>
+#include <mutex>
 
 namespace sgl {
 
@@ -41,11 +42,36 @@ public:
 
     ComputePipeline* pipeline() const;
 
+    /// Thread group size of the compute entry point.
+    uint3 thread_group_size() const { return m_thread_group_size; }
+
     void dispatch(uint3 thread_count, BindVarsCallback bind_vars, CommandEncoder* command_encoder = nullptr);
 
+    /**
+     * Create a persistent root shader object for this kernel.
+     *
+     * The object can be populated once and passed to \c dispatch repeatedly,
+     * writing only the fields that changed in between dispatches.
+     */
+    ref<PersistentShaderObject> create_root_object() const;
+
+    /// Dispatch the kernel with all bindings recorded in a persistent root shader object.
+    void dispatch(
+        uint3 thread_count,
+        const PersistentShaderObject* root_object,
+        CommandEncoder* command_encoder = nullptr
+    );
+
 private:
+    void dispatch_impl(
+        uint3 thread_count,
+        const std::function<void(ShaderObject*)>& bind,
+        CommandEncoder* command_encoder
+    );
+
     uint3 m_thread_group_size;
     mutable ref<ComputePipeline> m_pipeline;
+    mutable std::mutex m_pipeline_mutex;
 };
 
 class SGL_API RayTracingKernel : public Kernel {
@@ -60,6 +86,7 @@ public:
 
 private:
     mutable ref<RayTracingPipeline> m_pipeline;
+    mutable std::mutex m_pipeline_mutex;
 };
 
 } // namespace sgl
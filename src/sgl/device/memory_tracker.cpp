@@ -0,0 +1,147 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "memory_tracker.h"
+
+#include "sgl/core/error.h"
+
+#include <algorithm>
+
+namespace sgl {
+
+void MemoryTracker::track(MemoryCategory category, std::string_view label, size_t size)
+{
+    update(category, label, size, true);
+}
+
+void MemoryTracker::untrack(MemoryCategory category, std::string_view label, size_t size)
+{
+    update(category, label, size, false);
+}
+
+MemoryCategoryStats MemoryTracker::stats(MemoryCategory category) const
+{
+    SGL_CHECK_LT(size_t(category), CATEGORY_COUNT);
+    std::lock_guard lock(m_mutex);
+    return m_stats[size_t(category)];
+}
+
+size_t MemoryTracker::device_usage() const
+{
+    std::lock_guard lock(m_mutex);
+    return m_device_usage;
+}
+
+size_t MemoryTracker::peak_device_usage() const
+{
+    std::lock_guard lock(m_mutex);
+    return m_peak_device_usage;
+}
+
+std::map<std::string, size_t> MemoryTracker::usage_by_label() const
+{
+    std::lock_guard lock(m_mutex);
+    std::map<std::string, size_t> result;
+    for (const auto& [label, usage] : m_label_usage)
+        result[label] = usage.size;
+    return result;
+}
+
+void MemoryTracker::reset_peak()
+{
+    std::lock_guard lock(m_mutex);
+    for (MemoryCategoryStats& stats : m_stats)
+        stats.peak = stats.current;
+    m_peak_device_usage = m_device_usage;
+}
+
+void MemoryTracker::set_budget(size_t budget, std::vector<float> thresholds)
+{
+    std::sort(thresholds.begin(), thresholds.end());
+    std::lock_guard lock(m_mutex);
+    m_budget = budget;
+    m_thresholds = std::move(thresholds);
+}
+
+size_t MemoryTracker::budget() const
+{
+    std::lock_guard lock(m_mutex);
+    return m_budget;
+}
+
+void MemoryTracker::register_budget_callback(MemoryBudgetCallback callback)
+{
+    std::lock_guard lock(m_mutex);
+    m_budget_callbacks.push_back(std::move(callback));
+}
+
+void MemoryTracker::update(MemoryCategory category, std::string_view label, size_t size, bool add)
+{
+    SGL_ASSERT_LT(size_t(category), CATEGORY_COUNT);
+    bool is_device_memory = category != MemoryCategory::shader_object;
+
+    std::vector<MemoryBudgetEvent> events;
+    std::vector<MemoryBudgetCallback> callbacks;
+
+    {
+        std::lock_guard lock(m_mutex);
+
+        MemoryCategoryStats& stats = m_stats[size_t(category)];
+        size_t old_usage = m_device_usage;
+
+        if (add) {
+            stats.current += size;
+            stats.count++;
+            stats.peak = std::max(stats.peak, stats.current);
+            if (is_device_memory) {
+                m_device_usage += size;
+                m_peak_device_usage = std::max(m_peak_device_usage, m_device_usage);
+            }
+        } else {
+            SGL_ASSERT(stats.current >= size && stats.count > 0);
+            stats.current -= size;
+            stats.count--;
+            if (is_device_memory)
+                m_device_usage -= size;
+        }
+
+        // Unlabeled objects are only accounted per category.
+        if (!label.empty()) {
+            if (add) {
+                LabelUsage& label_usage = m_label_usage[std::string(label)];
+                label_usage.size += size;
+                label_usage.count++;
+            } else {
+                auto it = m_label_usage.find(std::string(label));
+                SGL_ASSERT(it != m_label_usage.end());
+                it->second.size -= size;
+                if (--it->second.count == 0)
+                    m_label_usage.erase(it);
+            }
+        }
+
+        // Collect budget thresholds crossed by this update.
+        if (m_budget > 0 && m_device_usage != old_usage) {
+            for (float threshold : m_thresholds) {
+                size_t limit = size_t(double(threshold) * double(m_budget));
+                bool was_above = old_usage > limit;
+                bool is_above = m_device_usage > limit;
+                if (was_above != is_above)
+                    events.push_back({
+                        .threshold = threshold,
+                        .exceeded = is_above,
+                        .usage = m_device_usage,
+                        .budget = m_budget,
+                    });
+            }
+            if (!events.empty())
+                callbacks = m_budget_callbacks;
+        }
+    }
+
+    // Invoke callbacks without holding the lock, so they can query the tracker or release resources.
+    for (const MemoryBudgetEvent& event : events)
+        for (const MemoryBudgetCallback& callback : callbacks)
+            callback(event);
+}
+
+} // namespace sgl
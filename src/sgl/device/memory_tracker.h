@@ -0,0 +1,147 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "sgl/device/fwd.h"
+
+#include "sgl/core/macros.h"
+#include "sgl/core/enum.h"
+
+#include <array>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace sgl {
+
+enum class MemoryCategory : uint32_t {
+    /// Device local buffers.
+    buffer,
+    /// Textures.
+    texture,
+    /// Acceleration structures.
+    acceleration_structure,
+    /// Upload and read back buffers.
+    staging,
+    /// Shader objects (host memory for uniform data).
+    shader_object,
+};
+
+SGL_ENUM_INFO(
+    MemoryCategory,
+    {
+        {MemoryCategory::buffer, "buffer"},
+        {MemoryCategory::texture, "texture"},
+        {MemoryCategory::acceleration_structure, "acceleration_structure"},
+        {MemoryCategory::staging, "staging"},
+        {MemoryCategory::shader_object, "shader_object"},
+    }
+);
+SGL_ENUM_REGISTER(MemoryCategory);
+
+struct MemoryCategoryStats {
+    /// Current memory usage in bytes.
+    size_t current{0};
+    /// Peak memory usage in bytes.
+    size_t peak{0};
+    /// Number of live objects.
+    size_t count{0};
+};
+
+/// Event data for memory budget callbacks.
+struct MemoryBudgetEvent {
+    /// Threshold that was crossed, as a fraction of the budget.
+    float threshold;
+    /// True if usage rose above the threshold, false if it dropped below.
+    bool exceeded;
+    /// Device memory usage in bytes.
+    size_t usage;
+    /// Memory budget in bytes.
+    size_t budget;
+};
+using MemoryBudgetCallback = std::function<void(const MemoryBudgetEvent&)>;
+
+/// Memory registered with \c MemoryTracker::track, kept to unregister it later.
+struct TrackedMemory {
+    MemoryCategory category{MemoryCategory::buffer};
+    std::string label;
+    size_t size{0};
+};
+
+/**
+ * Tracks memory of all live resources created on a device.
+ *
+ * Resources register their memory on creation and unregister it once the underlying
+ * allocation is released (which may be deferred until pending submissions have finished).
+ * Usage is aggregated per \c MemoryCategory and per debug label. An optional budget
+ * invokes the registered callbacks whenever device memory usage crosses one of the
+ * budget thresholds. Shader objects account for host memory and are excluded from
+ * the device memory usage.
+ */
+class SGL_API MemoryTracker {
+public:
+    static constexpr size_t CATEGORY_COUNT = size_t(MemoryCategory::shader_object) + 1;
+
+    /// Register memory of a newly created object.
+    void track(MemoryCategory category, std::string_view label, size_t size);
+
+    /// Unregister memory of a destroyed object. Arguments must match the call to \c track.
+    void untrack(MemoryCategory category, std::string_view label, size_t size);
+
+    /// Unregister memory of a destroyed object.
+    void untrack(const TrackedMemory& memory) { untrack(memory.category, memory.label, memory.size); }
+
+    /// Statistics of a single category.
+    MemoryCategoryStats stats(MemoryCategory category) const;
+
+    /// Current device memory usage in bytes (all categories except shader objects).
+    size_t device_usage() const;
+
+    /// Peak device memory usage in bytes.
+    size_t peak_device_usage() const;
+
+    /// Current memory usage in bytes per debug label. Objects without a label are not included.
+    std::map<std::string, size_t> usage_by_label() const;
+
+    /// Reset peak usage to the current usage.
+    void reset_peak();
+
+    /**
+     * Set the device memory budget.
+     *
+     * \param budget Budget in bytes (0 to disable).
+     * \param thresholds Thresholds as fractions of the budget at which callbacks are invoked.
+     */
+    void set_budget(size_t budget, std::vector<float> thresholds = {0.75f, 0.9f, 1.f});
+
+    /// Device memory budget in bytes (0 if disabled).
+    size_t budget() const;
+
+    /// Register a callback invoked when device memory usage crosses a budget threshold.
+    void register_budget_callback(MemoryBudgetCallback callback);
+
+private:
+    void update(MemoryCategory category, std::string_view label, size_t size, bool add);
+
+    mutable std::mutex m_mutex;
+
+    std::array<MemoryCategoryStats, CATEGORY_COUNT> m_stats;
+    size_t m_device_usage{0};
+    size_t m_peak_device_usage{0};
+
+    struct LabelUsage {
+        size_t size{0};
+        size_t count{0};
+    };
+    std::unordered_map<std::string, LabelUsage> m_label_usage;
+
+    size_t m_budget{0};
+    std::vector<float> m_thresholds;
+    std::vector<MemoryBudgetCallback> m_budget_callbacks;
+};
+
+} // namespace sgl
@@ -30,6 +30,8 @@ public:
 
     void notify_program_reloaded();
 
+    ShaderProgram* program() const { return m_program; }
+
 protected:
     virtual void recreate() = 0;
 
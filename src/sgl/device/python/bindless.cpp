@@ -0,0 +1,66 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "nanobind.h"
+
+#include "sgl/device/bindless.h"
+#include "sgl/device/resource.h"
+#include "sgl/device/sampler.h"
+
+namespace sgl {
+SGL_DICT_TO_DESC_BEGIN(BindlessResourceTableDesc)
+SGL_DICT_TO_DESC_FIELD(texture_capacity, uint32_t)
+SGL_DICT_TO_DESC_FIELD(buffer_capacity, uint32_t)
+SGL_DICT_TO_DESC_FIELD(sampler_capacity, uint32_t)
+SGL_DICT_TO_DESC_END()
+} // namespace sgl
+
+SGL_PY_EXPORT(device_bindless)
+{
+    using namespace sgl;
+
+    nb::class_<BindlessResourceTableDesc>(m, "BindlessResourceTableDesc", D(BindlessResourceTableDesc))
+        .def(nb::init<>())
+        .def(
+            "__init__",
+            [](BindlessResourceTableDesc* self, nb::dict dict)
+            { new (self) BindlessResourceTableDesc(dict_to_BindlessResourceTableDesc(dict)); }
+        )
+        .def_rw(
+            "texture_capacity",
+            &BindlessResourceTableDesc::texture_capacity,
+            D(BindlessResourceTableDesc, texture_capacity)
+        )
+        .def_rw(
+            "buffer_capacity",
+            &BindlessResourceTableDesc::buffer_capacity,
+            D(BindlessResourceTableDesc, buffer_capacity)
+        )
+        .def_rw(
+            "sampler_capacity",
+            &BindlessResourceTableDesc::sampler_capacity,
+            D(BindlessResourceTableDesc, sampler_capacity)
+        );
+    nb::implicitly_convertible<nb::dict, BindlessResourceTableDesc>();
+
+    nb::class_<BindlessResourceTable, Object>(m, "BindlessResourceTable", D(BindlessResourceTable))
+        .def_prop_ro("desc", &BindlessResourceTable::desc, D(BindlessResourceTable, desc))
+        .def("add_texture", &BindlessResourceTable::add_texture, "texture"_a, D(BindlessResourceTable, add_texture))
+        .def("add_buffer", &BindlessResourceTable::add_buffer, "buffer"_a, D(BindlessResourceTable, add_buffer))
+        .def("add_sampler", &BindlessResourceTable::add_sampler, "sampler"_a, D(BindlessResourceTable, add_sampler))
+        .def(
+            "remove_texture",
+            &BindlessResourceTable::remove_texture,
+            "index"_a,
+            D(BindlessResourceTable, remove_texture)
+        )
+        .def("remove_buffer", &BindlessResourceTable::remove_buffer, "index"_a, D(BindlessResourceTable, remove_buffer))
+        .def(
+            "remove_sampler",
+            &BindlessResourceTable::remove_sampler,
+            "index"_a,
+            D(BindlessResourceTable, remove_sampler)
+        )
+        .def_prop_ro("texture_count", &BindlessResourceTable::texture_count, D(BindlessResourceTable, texture_count))
+        .def_prop_ro("buffer_count", &BindlessResourceTable::buffer_count, D(BindlessResourceTable, buffer_count))
+        .def_prop_ro("sampler_count", &BindlessResourceTable::sampler_count, D(BindlessResourceTable, sampler_count));
+}
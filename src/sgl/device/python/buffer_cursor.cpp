@@ -104,6 +104,56 @@ SGL_PY_EXPORT(device_buffer_cursor)
         .def_prop_ro("is_loaded", &BufferCursor::is_loaded, D(BufferCursor, is_loaded))
         .def("load", &BufferCursor::load, D(BufferCursor, load))
         .def("apply", &BufferCursor::apply, D(BufferCursor, apply))
+        .def_prop_ro("dirty_size", &BufferCursor::dirty_size, D(BufferCursor, dirty_size))
+        .def(
+            "write_columns",
+            [](BufferCursor& self, nb::object columns, size_t first)
+            {
+                // Split a numpy structured array into its fields.
+                nb::dict dict;
+                if (nb::isinstance<nb::dict>(columns)) {
+                    dict = nb::borrow<nb::dict>(columns);
+                } else {
+                    nb::object names = columns.attr("dtype").attr("names");
+                    SGL_CHECK(!names.is_none(), "Expected a dict of arrays or a numpy structured array");
+                    for (nb::handle name : names)
+                        dict[name] = columns[name];
+                }
+
+                nb::object ascontiguousarray = nb::module_::import_("numpy").attr("ascontiguousarray");
+                std::vector<nb::ndarray<nb::device::cpu>> arrays;
+                std::vector<BufferColumn> buffer_columns;
+                size_t count = 0;
+                for (auto [name, value] : dict) {
+                    std::string path = nb::cast<std::string>(name);
+                    auto array = nb::cast<nb::ndarray<nb::device::cpu>>(ascontiguousarray(value));
+                    std::optional<Struct::Type> type = dtype_to_struct_type(array.dtype());
+                    SGL_CHECK(type, "Column \"{}\" has an unsupported dtype", path);
+                    SGL_CHECK(array.ndim() > 0, "Column \"{}\" must be an array", path);
+                    if (arrays.empty())
+                        count = array.shape(0);
+                    SGL_CHECK(
+                        array.shape(0) == count,
+                        "Column \"{}\" has {} elements, expected {}",
+                        path,
+                        array.shape(0),
+                        count
+                    );
+                    buffer_columns.push_back({
+                        .path = std::move(path),
+                        .data = array.data(),
+                        .size = array.nbytes(),
+                        .type = *type,
+                    });
+                    arrays.push_back(std::move(array));
+                }
+
+                self.write_columns(buffer_columns, first, count);
+            },
+            "columns"_a,
+            "first"_a = 0,
+            D(BufferCursor, write_columns)
+        )
         .def_prop_ro("resource", &BufferCursor::resource, D(BufferCursor, resource))
         .def("__getitem__", [](BufferCursor& self, int index) { return self[index]; })
         .def("__len__", [](BufferCursor& self) { return self.element_count(); })
@@ -188,4 +238,68 @@ SGL_PY_EXPORT(device_buffer_cursor)
                 }
             }
         );
+
+    nb::class_<BufferFieldAccessor>(m, "BufferFieldAccessor", D(BufferFieldAccessor))
+        .def(
+            nb::init<ref<BufferCursor>, std::string_view>(),
+            "cursor"_a,
+            "path"_a,
+            D(BufferFieldAccessor, BufferFieldAccessor, 2)
+        )
+        .def_prop_ro("cursor", &BufferFieldAccessor::cursor, D(BufferFieldAccessor, cursor))
+        .def_prop_ro("path", &BufferFieldAccessor::path, D(BufferFieldAccessor, path))
+        .def_prop_ro("type_layout", &BufferFieldAccessor::type_layout, D(BufferFieldAccessor, type_layout))
+        .def_prop_ro("offset", &BufferFieldAccessor::offset, D(BufferFieldAccessor, offset))
+        .def_prop_ro("size", &BufferFieldAccessor::size, D(BufferFieldAccessor, size))
+        .def("find_element", &BufferFieldAccessor::find_element, "index"_a, D(BufferFieldAccessor, find_element))
+        .def("__getitem__", [](BufferFieldAccessor& self, size_t index) { return self[index]; })
+        .def(
+            "__setitem__",
+            [](BufferFieldAccessor& self, size_t index, nb::object value)
+            {
+                BufferElementCursor cursor = self[index];
+                detail::_writeconv.write(cursor, value);
+            }
+        )
+        .def(
+            "set_range",
+            [](BufferFieldAccessor& self, size_t first, nb::ndarray<nb::device::cpu> data)
+            {
+                SGL_CHECK(is_ndarray_contiguous(data), "data is not contiguous");
+                SGL_CHECK(data.ndim() > 0, "data must be an array");
+                size_t count = data.shape(0);
+
+                // Raw field bytes, as returned by get_range.
+                if (data.dtype() == nb::dtype<uint8_t>() && data.ndim() == 2 && data.shape(1) == self.size()) {
+                    self.set_range(first, count, data.data());
+                    return;
+                }
+
+                // Otherwise the first dimension is the element count, and the values are checked
+                // against (and converted to) the scalar type and component count of the field.
+                std::optional<Struct::Type> type = dtype_to_struct_type(data.dtype());
+                SGL_CHECK(type, "data has an unsupported dtype");
+                self.set_range(first, count, data.data(), data.nbytes(), *type);
+            },
+            "first"_a,
+            "data"_a,
+            D(BufferFieldAccessor, set_range)
+        )
+        .def(
+            "get_range",
+            [](BufferFieldAccessor& self, size_t first, size_t count)
+            {
+                size_t size = self.size();
+                uint8_t* data = new uint8_t[count * size];
+                self.get_range(first, count, data);
+                nb::capsule owner(data, [](void* p) noexcept { delete[] reinterpret_cast<uint8_t*>(p); });
+                size_t shape[2] = {count, size};
+                return nb::ndarray<
+                    nb::numpy>(data, 2, shape, owner, nullptr, nb::dtype<uint8_t>(), nb::device::cpu::value);
+            },
+            "first"_a,
+            "count"_a,
+            D(BufferFieldAccessor, get_range)
+        )
+        .def("__repr__", &BufferFieldAccessor::to_string);
 }
@@ -0,0 +1,97 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "nanobind.h"
+
+#include "sgl/device/buffer_heap.h"
+
+namespace sgl {
+SGL_DICT_TO_DESC_BEGIN(BufferHeapDesc)
+SGL_DICT_TO_DESC_FIELD(memory_type, MemoryType)
+SGL_DICT_TO_DESC_FIELD(usage, BufferUsage)
+SGL_DICT_TO_DESC_FIELD(page_size, size_t)
+SGL_DICT_TO_DESC_FIELD(min_block_size, size_t)
+SGL_DICT_TO_DESC_FIELD(label, std::string)
+SGL_DICT_TO_DESC_END()
+} // namespace sgl
+
+SGL_PY_EXPORT(device_buffer_heap)
+{
+    using namespace sgl;
+
+    nb::class_<BufferHeapDesc>(m, "BufferHeapDesc", D(BufferHeapDesc))
+        .def(nb::init<>())
+        .def(
+            "__init__",
+            [](BufferHeapDesc* self, nb::dict dict) { new (self) BufferHeapDesc(dict_to_BufferHeapDesc(dict)); }
+        )
+        .def_rw("memory_type", &BufferHeapDesc::memory_type, D(BufferHeapDesc, memory_type))
+        .def_rw("usage", &BufferHeapDesc::usage, D(BufferHeapDesc, usage))
+        .def_rw("page_size", &BufferHeapDesc::page_size, D(BufferHeapDesc, page_size))
+        .def_rw("min_block_size", &BufferHeapDesc::min_block_size, D(BufferHeapDesc, min_block_size))
+        .def_rw("label", &BufferHeapDesc::label, D(BufferHeapDesc, label));
+    nb::implicitly_convertible<nb::dict, BufferHeapDesc>();
+
+    nb::class_<BufferHeapStats>(m, "BufferHeapStats", D(BufferHeapStats))
+        .def_ro("page_count", &BufferHeapStats::page_count, D(BufferHeapStats, page_count))
+        .def_ro("reserved_size", &BufferHeapStats::reserved_size, D(BufferHeapStats, reserved_size))
+        .def_ro("allocated_size", &BufferHeapStats::allocated_size, D(BufferHeapStats, allocated_size))
+        .def_ro("requested_size", &BufferHeapStats::requested_size, D(BufferHeapStats, requested_size))
+        .def_ro("pending_free_size", &BufferHeapStats::pending_free_size, D(BufferHeapStats, pending_free_size))
+        .def_ro("allocation_count", &BufferHeapStats::allocation_count, D(BufferHeapStats, allocation_count))
+        .def_ro("occupancy", &BufferHeapStats::occupancy, D(BufferHeapStats, occupancy))
+        .def_ro("fragmentation", &BufferHeapStats::fragmentation, D(BufferHeapStats, fragmentation));
+
+    nb::class_<BufferHeap, DeviceResource>(m, "BufferHeap", D(BufferHeap))
+        .def_prop_ro("desc", &BufferHeap::desc, D(BufferHeap, desc))
+        .def("allocate", &BufferHeap::allocate, "size"_a, D(BufferHeap, allocate))
+        .def("trim", &BufferHeap::trim, D(BufferHeap, trim))
+        .def_prop_ro("stats", &BufferHeap::stats, D(BufferHeap, stats));
+
+    nb::class_<BufferHeapAllocation, Object>(m, "BufferHeapAllocation", D(BufferHeapAllocation))
+        .def_prop_ro("buffer", &BufferHeapAllocation::buffer, D(BufferHeapAllocation, buffer))
+        .def_prop_ro("offset", &BufferHeapAllocation::offset, D(BufferHeapAllocation, offset))
+        .def_prop_ro("size", &BufferHeapAllocation::size, D(BufferHeapAllocation, size))
+        .def_prop_ro("device_address", &BufferHeapAllocation::device_address, D(BufferHeapAllocation, device_address))
+        .def_prop_ro(
+            "buffer_offset_pair",
+            &BufferHeapAllocation::buffer_offset_pair,
+            D(BufferHeapAllocation, buffer_offset_pair)
+        )
+        .def(
+            "create_view",
+            &BufferHeapAllocation::create_view,
+            "format"_a = Format::undefined,
+            D(BufferHeapAllocation, create_view)
+        )
+        .def(
+            "to_numpy",
+            [](BufferHeapAllocation* self)
+            {
+                size_t data_size = self->size();
+                void* data = new uint8_t[data_size];
+                self->get_data(data, data_size);
+                nb::capsule owner(data, [](void* p) noexcept { delete[] reinterpret_cast<uint8_t*>(p); });
+                size_t shape[1] = {data_size};
+                return nb::ndarray<
+                    nb::numpy>(data, 1, shape, owner, nullptr, nb::dtype<uint8_t>(), nb::device::cpu::value);
+            },
+            D_NA(BufferHeapAllocation, to_numpy)
+        )
+        .def(
+            "copy_from_numpy",
+            [](BufferHeapAllocation* self, nb::ndarray<nb::numpy> data)
+            {
+                SGL_CHECK(is_ndarray_contiguous(data), "numpy array is not contiguous");
+                size_t data_size = data.nbytes();
+                SGL_CHECK(
+                    data_size <= self->size(),
+                    "numpy array is larger than the allocation ({} > {})",
+                    data_size,
+                    self->size()
+                );
+                self->set_data(data.data(), data_size);
+            },
+            "data"_a,
+            D_NA(BufferHeapAllocation, copy_from_numpy)
+        );
+}
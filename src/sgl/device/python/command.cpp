@@ -330,6 +330,22 @@ SGL_PY_EXPORT(device_command)
             "extent"_a = uint3(-1),
             D(CommandEncoder, copy_buffer_to_texture)
         )
+        .def(
+            "read_buffer_async",
+            &CommandEncoder::read_buffer_async,
+            "buffer"_a,
+            "offset"_a,
+            "size"_a,
+            D(CommandEncoder, read_buffer_async)
+        )
+        .def(
+            "read_texture_async",
+            &CommandEncoder::read_texture_async,
+            "texture"_a,
+            "layer"_a = 0,
+            "mip"_a = 0,
+            D(CommandEncoder, read_texture_async)
+        )
         .def("upload_buffer_data", &upload_buffer_data, "buffer"_a, "offset"_a, "data"_a)
         .def(
             "upload_texture_data",
@@ -680,4 +696,27 @@ SGL_PY_EXPORT(device_command)
         );
 
     nb::class_<CommandBuffer, DeviceResource>(m, "CommandBuffer", D(CommandBuffer));
+
+    nb::class_<AsyncReadback, DeviceResource>(m, "AsyncReadback", D(AsyncReadback))
+        .def_prop_ro("size", &AsyncReadback::size, D(AsyncReadback, size))
+        .def_prop_ro("layout", &AsyncReadback::layout, D(AsyncReadback, layout))
+        .def_prop_ro("is_submitted", &AsyncReadback::is_submitted, D(AsyncReadback, is_submitted))
+        .def_prop_ro("submit_id", &AsyncReadback::submit_id, D(AsyncReadback, submit_id))
+        .def_prop_ro("is_ready", &AsyncReadback::is_ready, D(AsyncReadback, is_ready))
+        .def("wait", &AsyncReadback::wait, nb::call_guard<nb::gil_scoped_release>(), D(AsyncReadback, wait))
+        .def(
+            "to_numpy",
+            [](const AsyncReadback* self)
+            {
+                // Texture read backs are returned in their raw layout (see layout.row_pitch).
+                size_t size = self->size();
+                uint8_t* data = new uint8_t[size];
+                self->read(data, size);
+                nb::capsule owner(data, [](void* p) noexcept { delete[] reinterpret_cast<uint8_t*>(p); });
+                size_t shape[1] = {size};
+                return nb::ndarray<
+                    nb::numpy>(data, 1, shape, owner, nullptr, nb::dtype<uint8_t>(), nb::device::cpu::value);
+            },
+            D(AsyncReadback, to_numpy)
+        );
 }
@@ -7,6 +7,8 @@
 #include "sgl/device/sampler.h"
 #include "sgl/device/fence.h"
 #include "sgl/device/resource.h"
+#include "sgl/device/buffer_heap.h"
+#include "sgl/device/transient_resource_pool.h"
 #include "sgl/device/pipeline.h"
 #include "sgl/device/kernel.h"
 #include "sgl/device/raytracing.h"
@@ -28,6 +30,10 @@ SGL_DICT_TO_DESC_FIELD(enable_hot_reload, bool)
 SGL_DICT_TO_DESC_FIELD(adapter_luid, AdapterLUID)
 SGL_DICT_TO_DESC_FIELD(compiler_options, SlangCompilerOptions)
 SGL_DICT_TO_DESC_FIELD(shader_cache_path, std::filesystem::path)
+SGL_DICT_TO_DESC_FIELD(enable_upload_batching, bool)
+SGL_DICT_TO_DESC_FIELD(upload_batch_size, size_t)
+SGL_DICT_TO_DESC_FIELD(enable_bindless, bool)
+SGL_DICT_TO_DESC_FIELD(bindless_desc, BindlessResourceTableDesc)
 SGL_DICT_TO_DESC_END()
 
 // Utility functions for doing CoopVec conversions between ndarrays
@@ -137,7 +143,15 @@ SGL_PY_EXPORT(device_device)
         .def_rw("enable_hot_reload", &DeviceDesc::enable_hot_reload, D(DeviceDesc, adapter_luid))
         .def_rw("adapter_luid", &DeviceDesc::adapter_luid, D(DeviceDesc, adapter_luid))
         .def_rw("compiler_options", &DeviceDesc::compiler_options, D(DeviceDesc, compiler_options))
-        .def_rw("shader_cache_path", &DeviceDesc::shader_cache_path, D(DeviceDesc, shader_cache_path));
+        .def_rw("shader_cache_path", &DeviceDesc::shader_cache_path, D(DeviceDesc, shader_cache_path))
+        .def_rw(
+            "enable_upload_batching",
+            &DeviceDesc::enable_upload_batching,
+            D(DeviceDesc, enable_upload_batching)
+        )
+        .def_rw("upload_batch_size", &DeviceDesc::upload_batch_size, D(DeviceDesc, upload_batch_size))
+        .def_rw("enable_bindless", &DeviceDesc::enable_bindless, D(DeviceDesc, enable_bindless))
+        .def_rw("bindless_desc", &DeviceDesc::bindless_desc, D(DeviceDesc, bindless_desc));
     nb::implicitly_convertible<nb::dict, DeviceDesc>();
 
     nb::class_<DeviceLimits>(m, "DeviceLimits", D(DeviceLimits))
@@ -239,7 +253,11 @@ SGL_PY_EXPORT(device_device)
            bool enable_hot_reload,
            std::optional<AdapterLUID> adapter_luid,
            std::optional<SlangCompilerOptions> compiler_options,
-           std::optional<std::filesystem::path> shader_cache_path)
+           std::optional<std::filesystem::path> shader_cache_path,
+           bool enable_upload_batching,
+           size_t upload_batch_size,
+           bool enable_bindless,
+           std::optional<BindlessResourceTableDesc> bindless_desc)
         {
             new (self) Device({
                 .type = type,
@@ -250,6 +268,10 @@ SGL_PY_EXPORT(device_device)
                 .adapter_luid = adapter_luid,
                 .compiler_options = compiler_options.value_or(SlangCompilerOptions{}),
                 .shader_cache_path = shader_cache_path,
+                .enable_upload_batching = enable_upload_batching,
+                .upload_batch_size = upload_batch_size,
+                .enable_bindless = enable_bindless,
+                .bindless_desc = bindless_desc.value_or(BindlessResourceTableDesc{}),
             });
         },
         "type"_a = DeviceDesc().type,
@@ -260,6 +282,10 @@ SGL_PY_EXPORT(device_device)
         "adapter_luid"_a.none() = nb::none(),
         "compiler_options"_a.none() = nb::none(),
         "shader_cache_path"_a.none() = nb::none(),
+        "enable_upload_batching"_a = DeviceDesc().enable_upload_batching,
+        "upload_batch_size"_a = DeviceDesc().upload_batch_size,
+        "enable_bindless"_a = DeviceDesc().enable_bindless,
+        "bindless_desc"_a.none() = nb::none(),
         D(Device, Device)
     );
     device.def(nb::init<DeviceDesc>(), "desc"_a, D(Device, Device));
@@ -295,6 +321,7 @@ SGL_PY_EXPORT(device_device)
            nb::object struct_type,
            Format format,
            MemoryType memory_type,
+           bool persistent_map,
            BufferUsage usage,
            std::string label,
            std::optional<nb::ndarray<nb::numpy>> data)
@@ -324,6 +351,7 @@ SGL_PY_EXPORT(device_device)
                 .struct_type = resolved_struct_type,
                 .format = format,
                 .memory_type = memory_type,
+                .persistent_map = persistent_map,
                 .usage = usage,
                 .label = std::move(label),
                 .data = data ? data->data() : nullptr,
@@ -336,6 +364,7 @@ SGL_PY_EXPORT(device_device)
         "struct_type"_a.none() = nb::none(),
         "format"_a = BufferDesc().format,
         "memory_type"_a = BufferDesc().memory_type,
+        "persistent_map"_a = BufferDesc().persistent_map,
         "usage"_a = BufferDesc().usage,
         "label"_a = BufferDesc().label,
         "data"_a.none() = nb::none(),
@@ -348,6 +377,45 @@ SGL_PY_EXPORT(device_device)
         D(Device, create_buffer)
     );
 
+    device.def(
+        "create_buffer_heap",
+        [](Device* self,
+           MemoryType memory_type,
+           BufferUsage usage,
+           size_t page_size,
+           size_t min_block_size,
+           std::string label)
+        {
+            return self->create_buffer_heap({
+                .memory_type = memory_type,
+                .usage = usage,
+                .page_size = page_size,
+                .min_block_size = min_block_size,
+                .label = std::move(label),
+            });
+        },
+        "memory_type"_a = BufferHeapDesc().memory_type,
+        "usage"_a = BufferHeapDesc().usage,
+        "page_size"_a = BufferHeapDesc().page_size,
+        "min_block_size"_a = BufferHeapDesc().min_block_size,
+        "label"_a = BufferHeapDesc().label,
+        D(Device, create_buffer_heap)
+    );
+    device.def(
+        "create_buffer_heap",
+        [](Device* self, const BufferHeapDesc& desc) { return self->create_buffer_heap(desc); },
+        "desc"_a,
+        D(Device, create_buffer_heap)
+    );
+
+    device.def(
+        "create_transient_resource_pool",
+        [](Device* self, bool enable_aliasing)
+        { return self->create_transient_resource_pool({.enable_aliasing = enable_aliasing}); },
+        "enable_aliasing"_a = TransientResourcePoolDesc().enable_aliasing,
+        D(Device, create_transient_resource_pool)
+    );
+
     device.def(
         "create_texture",
         [](Device* self,
@@ -530,8 +598,40 @@ SGL_PY_EXPORT(device_device)
         "queue"_a = CommandQueueType::graphics,
         D(Device, submit_command_buffer)
     );
+    device.def(
+        "record_parallel",
+        [](Device* self, std::vector<RecordCommandsCallback> callbacks, CommandQueueType queue)
+        { return self->record_parallel(callbacks, queue); },
+        "callbacks"_a,
+        "queue"_a = CommandQueueType::graphics,
+        nb::call_guard<nb::gil_scoped_release>(),
+        D(Device, record_parallel)
+    );
+    device.def(
+        "submit_parallel",
+        [](Device* self, std::vector<RecordCommandsCallback> callbacks, CommandQueueType queue)
+        { return self->submit_parallel(callbacks, queue); },
+        "callbacks"_a,
+        "queue"_a = CommandQueueType::graphics,
+        nb::call_guard<nb::gil_scoped_release>(),
+        D(Device, submit_parallel)
+    );
     device.def("is_submit_finished", &Device::is_submit_finished, "id"_a, D(Device, is_submit_finished));
     device.def("wait_for_submit", &Device::wait_for_submit, "id"_a, D(Device, wait_for_submit));
+    device.def_prop_ro("last_submit_id", &Device::last_submit_id, D(Device, last_submit_id));
+    device.def(
+        "queue_wait_for_submit",
+        &Device::queue_wait_for_submit,
+        "queue"_a,
+        "submit_id"_a,
+        D(Device, queue_wait_for_submit)
+    );
+    device.def_prop_ro(
+        "memory_tracker",
+        nb::overload_cast<>(&Device::memory_tracker),
+        nb::rv_policy::reference_internal,
+        D(Device, memory_tracker)
+    );
     device
         .def("wait_for_idle", &Device::wait_for_idle, "queue"_a = CommandQueueType::graphics, D(Device, wait_for_idle));
     device.def(
@@ -747,9 +847,19 @@ SGL_PY_EXPORT(device_device)
     );
     device.def("create_compute_kernel", &Device::create_compute_kernel, "desc"_a, D(Device, create_compute_kernel));
 
+    device.def_prop_ro("bindless_table", &Device::bindless_table, D(Device, bindless_table));
     device.def("flush_print", &Device::flush_print, D(Device, flush_print));
     device.def("flush_print_to_string", &Device::flush_print_to_string, D(Device, flush_print_to_string));
     device.def("wait", &Device::wait, D(Device, wait));
+    device.def("flush_uploads", &Device::flush_uploads, D(Device, flush_uploads));
+    device.def_prop_ro("pending_upload_size", &Device::pending_upload_size, D(Device, pending_upload_size));
+    device.def(
+        "collect_deferred_releases",
+        &Device::collect_deferred_releases,
+        "max_count"_a = 0,
+        D(Device, collect_deferred_releases)
+    );
+    device.def_prop_ro("deferred_release_count", &Device::deferred_release_count, D(Device, deferred_release_count));
     device.def(
         "register_shader_hot_reload_callback",
         &Device::register_shader_hot_reload_callback,
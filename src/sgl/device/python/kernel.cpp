@@ -8,6 +8,7 @@
 #include "sgl/device/sampler.h"
 #include "sgl/device/pipeline.h"
 #include "sgl/device/shader.h"
+#include "sgl/device/shader_object.h"
 
 namespace sgl {
 
@@ -34,6 +35,16 @@ SGL_PY_EXPORT(device_kernel)
 
     nb::class_<ComputeKernel, Kernel>(m, "ComputeKernel", D(ComputeKernel))
         .def_prop_ro("pipeline", &ComputeKernel::pipeline, D(ComputeKernel, pipeline))
+        .def_prop_ro("thread_group_size", &ComputeKernel::thread_group_size, D(ComputeKernel, thread_group_size))
+        .def("create_root_object", &ComputeKernel::create_root_object, D(ComputeKernel, create_root_object))
+        .def(
+            "dispatch",
+            nb::overload_cast<uint3, const PersistentShaderObject*, CommandEncoder*>(&ComputeKernel::dispatch),
+            "thread_count"_a,
+            "root_object"_a,
+            "command_encoder"_a = nullptr,
+            D(ComputeKernel, dispatch, 2)
+        )
         .def(
             "dispatch",
             [](ComputeKernel* self,
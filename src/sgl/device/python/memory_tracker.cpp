@@ -0,0 +1,44 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "nanobind.h"
+
+#include "sgl/device/memory_tracker.h"
+
+SGL_PY_EXPORT(device_memory_tracker)
+{
+    using namespace sgl;
+
+    nb::sgl_enum<MemoryCategory>(m, "MemoryCategory");
+
+    nb::class_<MemoryCategoryStats>(m, "MemoryCategoryStats", D(MemoryCategoryStats))
+        .def_ro("current", &MemoryCategoryStats::current, D(MemoryCategoryStats, current))
+        .def_ro("peak", &MemoryCategoryStats::peak, D(MemoryCategoryStats, peak))
+        .def_ro("count", &MemoryCategoryStats::count, D(MemoryCategoryStats, count));
+
+    nb::class_<MemoryBudgetEvent>(m, "MemoryBudgetEvent", D(MemoryBudgetEvent))
+        .def_ro("threshold", &MemoryBudgetEvent::threshold, D(MemoryBudgetEvent, threshold))
+        .def_ro("exceeded", &MemoryBudgetEvent::exceeded, D(MemoryBudgetEvent, exceeded))
+        .def_ro("usage", &MemoryBudgetEvent::usage, D(MemoryBudgetEvent, usage))
+        .def_ro("budget", &MemoryBudgetEvent::budget, D(MemoryBudgetEvent, budget));
+
+    nb::class_<MemoryTracker>(m, "MemoryTracker", D(MemoryTracker))
+        .def("stats", &MemoryTracker::stats, "category"_a, D(MemoryTracker, stats))
+        .def_prop_ro("device_usage", &MemoryTracker::device_usage, D(MemoryTracker, device_usage))
+        .def_prop_ro("peak_device_usage", &MemoryTracker::peak_device_usage, D(MemoryTracker, peak_device_usage))
+        .def("usage_by_label", &MemoryTracker::usage_by_label, D(MemoryTracker, usage_by_label))
+        .def("reset_peak", &MemoryTracker::reset_peak, D(MemoryTracker, reset_peak))
+        .def(
+            "set_budget",
+            &MemoryTracker::set_budget,
+            "budget"_a,
+            "thresholds"_a = std::vector<float>{0.75f, 0.9f, 1.f},
+            D(MemoryTracker, set_budget)
+        )
+        .def_prop_ro("budget", &MemoryTracker::budget, D(MemoryTracker, budget))
+        .def(
+            "register_budget_callback",
+            &MemoryTracker::register_budget_callback,
+            "callback"_a,
+            D(MemoryTracker, register_budget_callback)
+        );
+}
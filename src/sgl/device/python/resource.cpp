@@ -16,6 +16,7 @@ SGL_DICT_TO_DESC_FIELD(size, size_t)
 SGL_DICT_TO_DESC_FIELD(struct_size, size_t)
 SGL_DICT_TO_DESC_FIELD(format, Format)
 SGL_DICT_TO_DESC_FIELD(memory_type, MemoryType)
+SGL_DICT_TO_DESC_FIELD(persistent_map, bool)
 SGL_DICT_TO_DESC_FIELD(usage, BufferUsage)
 SGL_DICT_TO_DESC_FIELD(default_state, ResourceState)
 SGL_DICT_TO_DESC_FIELD(label, std::string)
@@ -174,44 +175,15 @@ nb::ndarray<nb::numpy> texture_to_numpy(Texture* self, uint32_t layer, uint32_t
     SGL_CHECK_LT(layer, self->layer_count());
     SGL_CHECK_LT(mip, self->mip_count());
 
-    // Get the subresource data and corresponding layout. Depending on platform, these
-    // may not be tightly packed.
-    OwnedSubresourceData subresource_data = self->get_subresource_data(layer, mip);
-    SubresourceLayout src_layout = self->get_subresource_layout(mip);
-    SGL_ASSERT(subresource_data.size == src_layout.size_in_bytes);
-    SGL_ASSERT(subresource_data.row_pitch == src_layout.row_pitch);
-    SGL_ASSERT(subresource_data.slice_pitch == src_layout.slice_pitch);
-
-    // Get tightly packed layout for numpy array.
+    // Get tightly packed layout for numpy array and read the subresource directly into it.
+    // Depending on platform, the source data may not be tightly packed, in which case rows
+    // are repacked while copying.
     SubresourceLayout dst_layout = self->get_subresource_layout(mip, 1);
-
-    // Double check assumptions about column (aka block) size and dimensions
-    // being consistent regardless of packing are correct.
-    SGL_ASSERT(src_layout.col_pitch == dst_layout.col_pitch);
-    SGL_ASSERT(src_layout.row_count == dst_layout.row_count);
-    SGL_ASSERT(src_layout.size.x == dst_layout.size.x);
-    SGL_ASSERT(src_layout.size.y == dst_layout.size.y);
-    SGL_ASSERT(src_layout.size.z == dst_layout.size.z);
-
-    // Dest is tightly packed, so pitch must be <= source pitch.
-    SGL_ASSERT(src_layout.row_pitch >= dst_layout.row_pitch);
-
-    // TODO: Could have fast path here if layouts are the same, but for now its
-    // better to stress-test the full copy operation.
-    uint8_t* src_data = (uint8_t*)subresource_data.data;
-    uint8_t* dst_data = new uint8_t[dst_layout.size_in_bytes];
-    for (uint32_t slice_idx = 0; slice_idx < src_layout.size.z; slice_idx++) {
-        uint8_t* src_slice = src_data + slice_idx * src_layout.slice_pitch;
-        uint8_t* dst_slice = dst_data + slice_idx * dst_layout.slice_pitch;
-        for (uint32_t row_idx = 0; row_idx < src_layout.row_count; row_idx++) {
-            uint8_t* src_row = src_slice + row_idx * src_layout.row_pitch;
-            uint8_t* dst_row = dst_slice + row_idx * dst_layout.row_pitch;
-            std::memcpy(dst_row, src_row, dst_layout.row_pitch);
-        }
-    }
+    std::unique_ptr<uint8_t[]> dst_data(new uint8_t[dst_layout.size_in_bytes]);
+    self->get_subresource_data(layer, mip, dst_data.get(), dst_layout.size_in_bytes, dst_layout.row_pitch);
 
     size_t size = dst_layout.size_in_bytes;
-    void* data = dst_data;
+    void* data = dst_data.release();
     uint3 mip_size = dst_layout.size;
 
     nb::capsule owner(data, [](void* p) noexcept { delete[] reinterpret_cast<uint8_t*>(p); });
@@ -379,6 +351,7 @@ SGL_PY_EXPORT(device_resource)
         .def_rw("struct_size", &BufferDesc::struct_size, D(BufferDesc, struct_size))
         .def_rw("format", &BufferDesc::format, D(BufferDesc, format))
         .def_rw("memory_type", &BufferDesc::memory_type, D(BufferDesc, memory_type))
+        .def_rw("persistent_map", &BufferDesc::persistent_map, D(BufferDesc, persistent_map))
         .def_rw("usage", &BufferDesc::usage, D(BufferDesc, usage))
         .def_rw("default_state", &BufferDesc::default_state, D(BufferDesc, default_state))
         .def_rw("label", &BufferDesc::label, D(BufferDesc, label));
@@ -389,6 +362,7 @@ SGL_PY_EXPORT(device_resource)
         .def_prop_ro("size", &Buffer::size, D(Buffer, size))
         .def_prop_ro("struct_size", &Buffer::struct_size, D(Buffer, struct_size))
         .def_prop_ro("device_address", &Buffer::device_address, D(Buffer, device_address))
+        .def_prop_ro("is_persistently_mapped", &Buffer::is_persistently_mapped, D(Buffer, is_persistently_mapped))
         .def_prop_ro("shared_handle", &Buffer::shared_handle, D(Buffer, shared_handle))
         .def("to_numpy", &buffer_to_numpy, D(buffer_to_numpy))
         .def("copy_from_numpy", &buffer_copy_from_numpy, "data"_a, D(buffer_from_numpy))
@@ -518,7 +492,21 @@ SGL_PY_EXPORT(device_resource)
             "label"_a = TextureViewDesc().label,
             D(Texture, create_view)
         )
-        .def("to_bitmap", &Texture::to_bitmap, "layer"_a = 0, "mip"_a = 0, D(Texture, to_bitmap))
+        .def(
+            "to_bitmap",
+            nb::overload_cast<uint32_t, uint32_t>(&Texture::to_bitmap, nb::const_),
+            "layer"_a = 0,
+            "mip"_a = 0,
+            D(Texture, to_bitmap)
+        )
+        .def(
+            "to_bitmap",
+            nb::overload_cast<Bitmap*, uint32_t, uint32_t>(&Texture::to_bitmap, nb::const_),
+            "bitmap"_a,
+            "layer"_a = 0,
+            "mip"_a = 0,
+            D(Texture, to_bitmap_2)
+        )
         .def("to_numpy", &texture_to_numpy, "layer"_a = 0, "mip"_a = 0, D(texture_to_numpy))
         .def("copy_from_numpy", &texture_from_numpy, "data"_a, "layer"_a = 0, "mip"_a = 0, D(texture_from_numpy));
 
@@ -8,5 +8,32 @@ SGL_PY_EXPORT(device_shader_object)
 {
     using namespace sgl;
 
-    nb::class_<ShaderObject, Object>(m, "ShaderObject", D(ShaderObject));
+    nb::class_<ShaderObjectStats>(m, "ShaderObjectStats", D(ShaderObjectStats))
+        .def_ro("write_count", &ShaderObjectStats::write_count, D(ShaderObjectStats, write_count))
+        .def_ro(
+            "skipped_write_count",
+            &ShaderObjectStats::skipped_write_count,
+            D(ShaderObjectStats, skipped_write_count)
+        )
+        .def_ro("write_size", &ShaderObjectStats::write_size, D(ShaderObjectStats, write_size))
+        .def_ro("skipped_size", &ShaderObjectStats::skipped_size, D(ShaderObjectStats, skipped_size));
+
+    nb::class_<ShaderObject, Object>(m, "ShaderObject", D(ShaderObject))
+        .def_prop_rw(
+            "shadow_copy_enabled",
+            &ShaderObject::shadow_copy_enabled,
+            &ShaderObject::set_shadow_copy_enabled,
+            D(ShaderObject, shadow_copy_enabled)
+        )
+        .def_prop_ro("stats", &ShaderObject::stats, D(ShaderObject, stats))
+        .def("reset_stats", &ShaderObject::reset_stats, D(ShaderObject, reset_stats));
+
+    nb::class_<PersistentShaderObject, ShaderObject>(m, "PersistentShaderObject", D(PersistentShaderObject))
+        .def("apply", &PersistentShaderObject::apply, "target"_a, D(PersistentShaderObject, apply))
+        .def("clear", &PersistentShaderObject::clear, D(PersistentShaderObject, clear))
+        .def_prop_ro(
+            "uniform_data_size",
+            &PersistentShaderObject::uniform_data_size,
+            D(PersistentShaderObject, uniform_data_size)
+        );
 }
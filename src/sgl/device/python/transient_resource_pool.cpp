@@ -0,0 +1,69 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "nanobind.h"
+
+#include "sgl/device/transient_resource_pool.h"
+
+namespace sgl {
+SGL_DICT_TO_DESC_BEGIN(TransientResourcePoolDesc)
+SGL_DICT_TO_DESC_FIELD(enable_aliasing, bool)
+SGL_DICT_TO_DESC_END()
+} // namespace sgl
+
+SGL_PY_EXPORT(device_transient_resource_pool)
+{
+    using namespace sgl;
+
+    nb::class_<TransientResourcePoolDesc>(m, "TransientResourcePoolDesc", D(TransientResourcePoolDesc))
+        .def(nb::init<>())
+        .def(
+            "__init__",
+            [](TransientResourcePoolDesc* self, nb::dict dict)
+            { new (self) TransientResourcePoolDesc(dict_to_TransientResourcePoolDesc(dict)); }
+        )
+        .def_rw(
+            "enable_aliasing",
+            &TransientResourcePoolDesc::enable_aliasing,
+            D(TransientResourcePoolDesc, enable_aliasing)
+        );
+    nb::implicitly_convertible<nb::dict, TransientResourcePoolDesc>();
+
+    nb::class_<TransientResourcePoolStats>(m, "TransientResourcePoolStats", D(TransientResourcePoolStats))
+        .def_ro(
+            "created_count",
+            &TransientResourcePoolStats::created_count,
+            D(TransientResourcePoolStats, created_count)
+        )
+        .def_ro("reused_count", &TransientResourcePoolStats::reused_count, D(TransientResourcePoolStats, reused_count))
+        .def_ro("in_use_count", &TransientResourcePoolStats::in_use_count, D(TransientResourcePoolStats, in_use_count))
+        .def_ro("free_count", &TransientResourcePoolStats::free_count, D(TransientResourcePoolStats, free_count));
+
+    nb::class_<TransientResourcePool, DeviceResource>(m, "TransientResourcePool", D(TransientResourcePool))
+        .def_prop_ro("desc", &TransientResourcePool::desc, D(TransientResourcePool, desc))
+        .def(
+            "acquire_texture",
+            &TransientResourcePool::acquire_texture,
+            "desc"_a,
+            D(TransientResourcePool, acquire_texture)
+        )
+        .def(
+            "acquire_buffer",
+            &TransientResourcePool::acquire_buffer,
+            "desc"_a,
+            D(TransientResourcePool, acquire_buffer)
+        )
+        .def(
+            "release_texture",
+            &TransientResourcePool::release_texture,
+            "texture"_a,
+            D(TransientResourcePool, release_texture)
+        )
+        .def(
+            "release_buffer",
+            &TransientResourcePool::release_buffer,
+            "buffer"_a,
+            D(TransientResourcePool, release_buffer)
+        )
+        .def("trim", &TransientResourcePool::trim, D(TransientResourcePool, trim))
+        .def_prop_ro("stats", &TransientResourcePool::stats, D(TransientResourcePool, stats));
+}
@@ -88,9 +88,15 @@ AccelerationStructure::AccelerationStructure(ref<Device> device, AccelerationStr
         .label = m_desc.label.c_str(),
     };
     SLANG_CALL(m_device->rhi_device()->createAccelerationStructure(rhi_desc, m_rhi_acceleration_structure.writeRef()));
+
+    m_device->memory_tracker().track(MemoryCategory::acceleration_structure, m_desc.label, m_desc.size);
 }
 
-AccelerationStructure::~AccelerationStructure() { }
+AccelerationStructure::~AccelerationStructure()
+{
+    m_device->memory_tracker().untrack(MemoryCategory::acceleration_structure, m_desc.label, m_desc.size);
+    m_device->_deferred_release(m_rhi_acceleration_structure);
+}
 
 AccelerationStructureHandle AccelerationStructure::handle() const
 {
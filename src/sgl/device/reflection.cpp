@@ -9,28 +9,147 @@
 
 #include "sgl/math/vector.h"
 
+#include <array>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
 #include <span>
+#include <unordered_map>
 
 namespace sgl {
 
 namespace detail {
 
-    static std::map<void*, const BaseReflectionObject*> g_slang_reflection_to_sgl_reflection;
+    /// Select the shard of a cache keyed by slang reflection objects.
+    static size_t get_shard_index(void* slang_reflection, size_t shard_count)
+    {
+        // Slang reflection objects are heap allocated, so skip the low (alignment) bits.
+        uintptr_t key = reinterpret_cast<uintptr_t>(slang_reflection);
+        return ((key >> 4) ^ (key >> 12)) % shard_count;
+    }
+
+    /// Cache of reflection wrappers, keyed by the wrapped slang reflection object.
+    /// The cache is split into shards with separate locks, so that threads creating
+    /// wrappers for unrelated slang objects rarely contend.
+    /// Reference counts are never changed while holding a shard lock, as that may
+    /// need the Python GIL, which is held while wrappers are destroyed from Python.
+    class ReflectionCache {
+    public:
+        template<typename SGLType, typename SlangType>
+        ref<const SGLType> get_or_create(ref<const Object> owner, SlangType* slang_reflection)
+        {
+            Shard& shard = get_shard(slang_reflection);
+
+            const BaseReflectionObject* wrapper = nullptr;
+            bool needs_gil = false;
+            {
+                std::shared_lock lock(shard.mutex);
+                wrapper = try_get(shard, slang_reflection, false, needs_gil);
+            }
+            if (wrapper)
+                return adopt<SGLType>(wrapper);
+
+            // Python owned wrappers are revived with the GIL held, which prevents them from being
+            // destroyed concurrently. The GIL is acquired first to keep the lock order of destruction.
+            std::optional<ScopedGILPy> gil;
+            if (needs_gil)
+                gil.emplace();
+
+            while (true) {
+                std::unique_lock lock(shard.mutex);
+                // Another thread may have created the wrapper while the lock was released.
+                wrapper = try_get(shard, slang_reflection, gil.has_value(), needs_gil);
+                if (wrapper) {
+                    lock.unlock();
+                    return adopt<SGLType>(wrapper);
+                }
+                if (needs_gil && !gil) {
+                    lock.unlock();
+                    gil.emplace();
+                    continue;
+                }
+                // The new wrapper is owned by C++, so creating it does not need the GIL.
+                auto result = make_ref<const SGLType>(std::move(owner), slang_reflection);
+                shard.map[slang_reflection] = result.get();
+                return result;
+            }
+        }
+
+        void remove(void* slang_reflection, const BaseReflectionObject* wrapper)
+        {
+            Shard& shard = get_shard(slang_reflection);
+            std::unique_lock lock(shard.mutex);
+            // The entry may already refer to a new wrapper if this one was being destroyed when looked up.
+            auto it = shard.map.find(slang_reflection);
+            if (it != shard.map.end() && it->second == wrapper)
+                shard.map.erase(it);
+        }
+
+        void invalidate_all()
+        {
+            // Owners are released after unlocking, as that changes reference counts.
+            std::vector<ref<const Object>> owners;
+            for (Shard& shard : m_shards) {
+                std::unique_lock lock(shard.mutex);
+                for (auto& [_, reflection] : shard.map)
+                    owners.push_back(const_cast<BaseReflectionObject*>(reflection)->_hot_reload_invalidate());
+                shard.map.clear();
+            }
+        }
+
+    private:
+        static constexpr size_t SHARD_COUNT = 16;
+
+        struct alignas(64) Shard {
+            std::shared_mutex mutex;
+            std::unordered_map<void*, const BaseReflectionObject*> map;
+        };
+
+        Shard& get_shard(void* slang_reflection) { return m_shards[get_shard_index(slang_reflection, SHARD_COUNT)]; }
+
+        /// Look up a wrapper and take a reference to it, skipping wrappers whose last reference
+        /// was released concurrently. Python owned wrappers are only revived if \c has_gil is set,
+        /// otherwise \c needs_gil is set. Must be called with the shard lock held.
+        static const BaseReflectionObject* try_get(Shard& shard, void* slang_reflection, bool has_gil, bool& needs_gil)
+        {
+            auto it = shard.map.find(slang_reflection);
+            if (it == shard.map.end())
+                return nullptr;
+            const BaseReflectionObject* wrapper = it->second;
+            if (wrapper->try_inc_ref())
+                return wrapper;
+            // Python owned wrappers stay Python owned, otherwise the wrapper is being destroyed.
+            if (!wrapper->self_py())
+                return nullptr;
+            if (!has_gil) {
+                needs_gil = true;
+                return nullptr;
+            }
+            wrapper->inc_ref();
+            return wrapper;
+        }
+
+        /// Wrap a reference taken by \c try_get. Must be called without the shard lock held.
+        template<typename SGLType>
+        static ref<const SGLType> adopt(const BaseReflectionObject* wrapper)
+        {
+            ref<const SGLType> result(static_cast<const SGLType*>(wrapper));
+            wrapper->dec_ref();
+            return result;
+        }
+
+        std::array<Shard, SHARD_COUNT> m_shards;
+    };
+
+    static ReflectionCache g_reflection_cache;
 
     template<typename SGLType, typename SlangType>
     ref<const SGLType> create_reflection_type_from_slang_type(ref<const Object> owner, SlangType* slang_reflection)
     {
-        if (slang_reflection) {
-            auto it = g_slang_reflection_to_sgl_reflection.find(slang_reflection);
-            if (it != g_slang_reflection_to_sgl_reflection.end()) {
-                return ref((const SGLType*)it->second);
-            } else {
-                auto res = make_ref<const SGLType>(std::move(owner), slang_reflection);
-                g_slang_reflection_to_sgl_reflection[slang_reflection] = res.get();
-                return res;
-            }
-        } else
+        if (!slang_reflection)
             return nullptr;
+        return g_reflection_cache.get_or_create<SGLType>(std::move(owner), slang_reflection);
     }
 
 #define SGL_FROM_SLANG(type_name)                                                                                      \
@@ -50,20 +169,107 @@ namespace detail {
 
 #undef SGL_FROM_SLANG
 
-    void on_slang_wrapper_destroyed(void* slang_reflection)
+    void on_slang_wrapper_destroyed(void* slang_reflection, const BaseReflectionObject* wrapper)
     {
-        g_slang_reflection_to_sgl_reflection.erase(slang_reflection);
+        g_reflection_cache.remove(slang_reflection, wrapper);
     }
 
     void invalidate_all_reflection_data()
     {
-        for (auto& [_, reflection] : g_slang_reflection_to_sgl_reflection) {
-            const_cast<BaseReflectionObject*>(reflection)->_hot_reload_invalidate();
-        }
-        g_slang_reflection_to_sgl_reflection.clear();
+        g_reflection_cache.invalidate_all();
     }
 } // namespace detail
 
+FlatTypeLayoutCache::FlatTypeLayoutCache(ref<const Object> owner)
+    : m_owner(std::move(owner))
+{
+}
+
+FlatTypeLayoutCache::~FlatTypeLayoutCache() { }
+
+const FlatTypeLayout* FlatTypeLayoutCache::get(slang::TypeLayoutReflection* type_layout)
+{
+    SGL_ASSERT(type_layout);
+
+    {
+        std::shared_lock lock(m_mutex);
+        auto it = m_layouts.find(type_layout);
+        if (it != m_layouts.end())
+            return it->second.get();
+    }
+
+    // Nested layouts are built along with the table, so build under the exclusive lock.
+    std::unique_lock lock(m_mutex);
+    return get_or_build(type_layout);
+}
+
+const FlatTypeLayout* FlatTypeLayoutCache::get_or_build(slang::TypeLayoutReflection* type_layout)
+{
+    std::unique_ptr<FlatTypeLayout>& entry = m_layouts[type_layout];
+    if (entry)
+        return entry.get();
+
+    // The table is registered before building nested layouts, which may insert into the map.
+    entry = std::make_unique<FlatTypeLayout>();
+    FlatTypeLayout* flat = entry.get();
+    flat->type_layout = type_layout;
+    flat->kind = static_cast<TypeReflection::Kind>(type_layout->getKind());
+    flat->parameter_category = static_cast<TypeReflection::ParameterCategory>(type_layout->getParameterCategory());
+
+    switch (flat->kind) {
+    case TypeReflection::Kind::struct_: {
+        uint32_t field_count = type_layout->getFieldCount();
+        flat->fields.reserve(field_count);
+        for (uint32_t i = 0; i < field_count; ++i) {
+            slang::VariableLayoutReflection* field_layout = type_layout->getFieldByIndex(i);
+            slang::TypeLayoutReflection* field_type_layout = field_layout->getTypeLayout();
+            std::string name = field_layout->getName() ? field_layout->getName() : "";
+            flat->fields.push_back({
+                .name_hash = std::hash<std::string_view>{}(name),
+                .name = std::move(name),
+                .uniform_offset = narrow_cast<uint32_t>(field_layout->getOffset()),
+                .binding_range_offset = narrow_cast<int32_t>(type_layout->getFieldBindingRangeOffset(i)),
+                .type_layout = field_type_layout,
+                .layout = field_type_layout ? get_or_build(field_type_layout) : nullptr,
+            });
+        }
+        break;
+    }
+    case TypeReflection::Kind::array:
+    case TypeReflection::Kind::vector:
+    case TypeReflection::Kind::matrix:
+        flat->element_stride = narrow_cast<uint32_t>(type_layout->getElementStride(SLANG_PARAMETER_CATEGORY_UNIFORM));
+        flat->element_count = type_layout->getElementCount();
+        flat->element_type_layout = type_layout->getElementTypeLayout();
+        if (flat->element_type_layout)
+            flat->element_layout = get_or_build(flat->element_type_layout);
+        break;
+    default:
+        break;
+    }
+
+    slang::TypeLayoutReflection* leaf_layout = type_layout;
+    while (leaf_layout->isArray())
+        leaf_layout = leaf_layout->getElementTypeLayout();
+    if (slang::TypeReflection* leaf_type = leaf_layout->getType()) {
+        flat->leaf_kind = static_cast<TypeReflection::Kind>(leaf_type->getKind());
+        flat->leaf_scalar_type = static_cast<TypeReflection::ScalarType>(leaf_type->getScalarType());
+        flat->leaf_row_count = leaf_type->getRowCount();
+        flat->leaf_col_count = leaf_type->getColumnCount();
+    }
+
+    return flat;
+}
+
+const FlatTypeLayout::Field* FlatTypeLayout::find_field(std::string_view name) const
+{
+    size_t name_hash = std::hash<std::string_view>{}(name);
+    for (const Field& field : fields)
+        if (field.name_hash == name_hash && field.name == name)
+            return &field;
+    return nullptr;
+}
+
 std::string c_str_to_string(const char* str)
 {
     if (!str)
@@ -192,6 +398,14 @@ TypeLayoutReflectionFieldList TypeLayoutReflection::fields() const
     return TypeLayoutReflectionFieldList(ref(this));
 }
 
+const FlatTypeLayout* TypeLayoutReflection::flat_layout() const
+{
+    slang::TypeLayoutReflection* type_layout = slang_target();
+    // The cache does not hold a reference to this object, which would create a reference cycle.
+    std::call_once(m_flat_layouts_once, [&] { m_flat_layouts = make_ref<FlatTypeLayoutCache>(); });
+    return m_flat_layouts->get(type_layout);
+}
+
 std::string TypeLayoutReflection::to_string() const
 {
     switch (kind()) {
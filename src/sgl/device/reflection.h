@@ -14,12 +14,19 @@
 
 #include <slang.h>
 
+#include <atomic>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace sgl {
 
+class BaseReflectionObject;
+
 namespace detail {
 
     SGL_API ref<const DeclReflection> from_slang(ref<const Object> owner, slang::DeclReflection* decl_reflection);
@@ -36,7 +43,7 @@ namespace detail {
     from_slang(ref<const Object> owner, slang::EntryPointLayout* entry_point_reflection);
     SGL_API ref<const ProgramLayout> from_slang(ref<const Object> owner, slang::ProgramLayout* program_layout);
 
-    SGL_API void on_slang_wrapper_destroyed(void* slang_reflection);
+    SGL_API void on_slang_wrapper_destroyed(void* slang_reflection, const BaseReflectionObject* wrapper);
 
     SGL_API void invalidate_all_reflection_data();
 } // namespace detail
@@ -193,7 +200,8 @@ public:
     {
     }
 
-    virtual void _hot_reload_invalidate() { m_owner = nullptr; }
+    /// Invalidate the wrapper, returning the reference to its owner so it can be released by the caller.
+    virtual ref<const Object> _hot_reload_invalidate() { return std::move(m_owner); }
 
     bool is_valid() const { return m_owner != nullptr; }
 
@@ -209,7 +217,7 @@ public:
         , m_target(target)
     {
     }
-    ~BaseReflectionObjectImpl() { detail::on_slang_wrapper_destroyed(m_target); }
+    ~BaseReflectionObjectImpl() { detail::on_slang_wrapper_destroyed(m_target, this); }
 
     SlangType* slang_target() const
     {
@@ -217,10 +225,10 @@ public:
         return m_target;
     }
 
-    void _hot_reload_invalidate() override
+    ref<const Object> _hot_reload_invalidate() override
     {
-        BaseReflectionObject::_hot_reload_invalidate();
         m_target = nullptr;
+        return BaseReflectionObject::_hot_reload_invalidate();
     }
 
 private:
@@ -673,6 +681,34 @@ protected:
     ref<const VariableReflection> evaluate(uint32_t index) const override { return m_owner->get_field_by_index(index); }
 };
 
+struct FlatTypeLayout;
+
+/**
+ * Owner of flattened type layouts (see \c FlatTypeLayout).
+ *
+ * Tables are keyed by the slang type layout and live as long as the cache. A cache must only be
+ * queried with type layouts that stay alive as long as the cache, so that a key can never refer
+ * to a type layout that was freed and reallocated. Caches are therefore held by the objects that
+ * own the slang type layouts: shader programs, shader objects and type layout reflection objects.
+ */
+class SGL_API FlatTypeLayoutCache : public Object {
+    SGL_OBJECT(FlatTypeLayoutCache)
+public:
+    /// Constructor.
+    /// \param owner Object keeping the slang type layouts alive (optional).
+    FlatTypeLayoutCache(ref<const Object> owner = nullptr);
+    ~FlatTypeLayoutCache();
+
+    /// Get the flattened layout of a slang type layout, building it and all nested layouts on first use.
+    const FlatTypeLayout* get(slang::TypeLayoutReflection* type_layout);
+
+private:
+    const FlatTypeLayout* get_or_build(slang::TypeLayoutReflection* type_layout);
+
+    ref<const Object> m_owner;
+    std::shared_mutex m_mutex;
+    std::unordered_map<slang::TypeLayoutReflection*, std::unique_ptr<FlatTypeLayout>> m_layouts;
+};
 
 class SGL_API TypeLayoutReflection : public BaseReflectionObjectImpl<slang::TypeLayoutReflection> {
 public:
@@ -772,7 +808,14 @@ public:
         return narrow_cast<uint32_t>(slang_target()->getFieldBindingRangeOffset(field_index));
     }
 
+    /// Flattened layout of this type layout, built on first use and owned by this object.
+    const FlatTypeLayout* flat_layout() const;
+
     std::string to_string() const;
+
+private:
+    mutable std::once_flag m_flat_layouts_once;
+    mutable ref<FlatTypeLayoutCache> m_flat_layouts;
 };
 
 /// TypeLayoutReflection lazy field list evaluation.
@@ -1251,4 +1294,62 @@ private:
     bool m_valid{false};
 };
 
+/**
+ * Flattened copy of the layout information of a slang type layout.
+ *
+ * Cursors navigate and type check shader data on every access. Querying this through the
+ * slang reflection API involves many small out-of-line calls, so the information is gathered
+ * once per type layout into this compact table. Tables are owned by a \c FlatTypeLayoutCache
+ * and link to the tables of their fields and elements, so cursors navigate without lookups.
+ */
+struct SGL_API FlatTypeLayout {
+    struct Field {
+        /// Hash of the field name.
+        size_t name_hash;
+        /// Field name.
+        std::string name;
+        /// Uniform offset of the field in bytes.
+        uint32_t uniform_offset;
+        /// Binding range offset of the field relative to the struct.
+        int32_t binding_range_offset;
+        /// Type layout of the field.
+        slang::TypeLayoutReflection* type_layout;
+        /// Flattened layout of the field.
+        const FlatTypeLayout* layout;
+    };
+
+    /// The slang type layout.
+    slang::TypeLayoutReflection* type_layout{nullptr};
+    TypeReflection::Kind kind{TypeReflection::Kind::none};
+    TypeReflection::ParameterCategory parameter_category{TypeReflection::ParameterCategory::none};
+
+    /// Fields (structs only).
+    std::vector<Field> fields;
+
+    /// Uniform stride of elements in bytes (arrays, vectors and matrices only).
+    uint32_t element_stride{0};
+    /// Number of elements (arrays, vectors and matrices only).
+    size_t element_count{0};
+    /// Type layout of elements (arrays, vectors and matrices only).
+    slang::TypeLayoutReflection* element_type_layout{nullptr};
+    /// Flattened layout of elements (arrays, vectors and matrices only).
+    const FlatTypeLayout* element_layout{nullptr};
+
+    /// Kind of the type with all array dimensions unwrapped.
+    TypeReflection::Kind leaf_kind{TypeReflection::Kind::none};
+    /// Scalar type of the type with all array dimensions unwrapped.
+    TypeReflection::ScalarType leaf_scalar_type{TypeReflection::ScalarType::none_};
+    /// Row count of the type with all array dimensions unwrapped.
+    uint32_t leaf_row_count{0};
+    /// Column count of the type with all array dimensions unwrapped.
+    uint32_t leaf_col_count{0};
+
+    /// Host value type (see \c cursor_utils::value_type_key) that last passed the cursor type checks
+    /// for this layout. Cursors skip the checks for repeated writes of the same value type.
+    mutable std::atomic<uint64_t> checked_value_type{0};
+
+    /// Find a field by name. Returns nullptr if not found.
+    const Field* find_field(std::string_view name) const;
+};
+
 } // namespace sgl
@@ -16,6 +16,7 @@
 
 #include "sgl/stl/bit.h" // Replace with <bit> when available on all platforms.
 
+
 namespace sgl {
 
 // ----------------------------------------------------------------------------
@@ -116,6 +117,17 @@ Buffer::Buffer(ref<Device> device, BufferDesc desc)
 
     SLANG_CALL(m_device->rhi_device()->createBuffer(rhi_desc, nullptr, m_rhi_buffer.writeRef()));
 
+    // Map persistently mapped buffers once for their whole lifetime.
+    if (m_desc.persistent_map) {
+        SGL_CHECK(
+            m_desc.memory_type != MemoryType::device_local,
+            "Only buffers with memory type 'upload' or 'read_back' can be persistently mapped."
+        );
+        rhi::CpuAccessMode mode
+            = m_desc.memory_type == MemoryType::upload ? rhi::CpuAccessMode::Write : rhi::CpuAccessMode::Read;
+        SLANG_CALL(m_device->rhi_device()->mapBuffer(m_rhi_buffer, mode, &m_mapped_ptr));
+    }
+
     // Upload init data.
     if (m_desc.data)
         set_data(m_desc.data, m_desc.data_size);
@@ -123,16 +135,26 @@ Buffer::Buffer(ref<Device> device, BufferDesc desc)
     // Clear initial data fields in desc.
     m_desc.data = nullptr;
     m_desc.data_size = 0;
+
+    m_device->memory_tracker().track(memory_category(), m_desc.label, m_desc.size);
 }
 
 Buffer::~Buffer()
 {
     m_cuda_memory.reset();
+    if (m_desc.persistent_map && m_mapped_ptr)
+        m_device->rhi_device()->unmapBuffer(m_rhi_buffer);
+    m_device->_deferred_release(
+        m_rhi_buffer,
+        TrackedMemory{.category = memory_category(), .label = m_desc.label, .size = m_desc.size}
+    );
 }
 
 void* Buffer::map() const
 {
     SGL_ASSERT(m_desc.memory_type != MemoryType::device_local);
+    if (m_desc.persistent_map)
+        return m_mapped_ptr;
     SGL_ASSERT(m_mapped_ptr == nullptr);
     rhi::CpuAccessMode mode
         = m_desc.memory_type == MemoryType::upload ? rhi::CpuAccessMode::Write : rhi::CpuAccessMode::Read;
@@ -143,6 +165,8 @@ void* Buffer::map() const
 void Buffer::unmap() const
 {
     SGL_ASSERT(m_desc.memory_type != MemoryType::device_local);
+    if (m_desc.persistent_map)
+        return;
     SGL_ASSERT(m_mapped_ptr != nullptr);
     SLANG_CALL(m_device->rhi_device()->unmapBuffer(m_rhi_buffer));
     m_mapped_ptr = nullptr;
@@ -424,6 +448,9 @@ Texture::Texture(ref<Device> device, TextureDesc desc)
 
     // Clear initial data field in desc.
     m_desc.data = {};
+
+    m_tracked_memory = memory_usage().device;
+    m_device->memory_tracker().track(MemoryCategory::texture, m_desc.label, m_tracked_memory);
 }
 
 Texture::Texture(ref<Device> device, TextureDesc desc, rhi::ITexture* resource)
@@ -435,7 +462,14 @@ Texture::Texture(ref<Device> device, TextureDesc desc, rhi::ITexture* resource)
     m_rhi_texture = resource;
 }
 
-Texture::~Texture() { }
+Texture::~Texture()
+{
+    // Textures wrapping external resources are not tracked.
+    std::optional<TrackedMemory> memory;
+    if (m_tracked_memory > 0)
+        memory = TrackedMemory{.category = MemoryCategory::texture, .label = m_desc.label, .size = m_tracked_memory};
+    m_device->_deferred_release(m_rhi_texture, std::move(memory));
+}
 
 SubresourceLayout Texture::get_subresource_layout(uint32_t mip, uint32_t row_alignment) const
 {
@@ -463,6 +497,14 @@ OwnedSubresourceData Texture::get_subresource_data(uint32_t layer, uint32_t mip)
     return m_device->read_texture_data(this, layer, mip);
 }
 
+void Texture::get_subresource_data(uint32_t layer, uint32_t mip, void* data, size_t size, size_t row_pitch) const
+{
+    SGL_CHECK_LT(layer, layer_count());
+    SGL_CHECK_LT(mip, mip_count());
+
+    m_device->read_texture_data(this, layer, mip, data, size, row_pitch);
+}
+
 ref<TextureView> Texture::create_view(TextureViewDesc desc)
 {
     return m_device->create_texture_view(this, std::move(desc));
@@ -482,16 +524,22 @@ DeviceResource::MemoryUsage Texture::memory_usage() const
     return {.device = size};
 }
 
-ref<Bitmap> Texture::to_bitmap(uint32_t layer, uint32_t mip) const
+namespace {
+
+struct BitmapFormat {
+    Bitmap::PixelFormat pixel_format;
+    Bitmap::ComponentType component_type;
+    bool srgb_gamma;
+};
+
+BitmapFormat get_bitmap_format(const TextureDesc& desc)
 {
-    SGL_CHECK_LT(layer, layer_count());
-    SGL_CHECK_LT(mip, mip_count());
     SGL_CHECK(
-        m_desc.type == TextureType::texture_2d || m_desc.type == TextureType::texture_2d_array,
+        desc.type == TextureType::texture_2d || desc.type == TextureType::texture_2d_array,
         "Cannot convert non-2D texture to bitmap."
     );
 
-    const FormatInfo& info = get_format_info(m_desc.format);
+    const FormatInfo& info = get_format_info(desc.format);
     if (info.is_compressed)
         SGL_THROW("Cannot convert compressed texture to bitmap.");
     if (info.is_depth_stencil())
@@ -566,21 +614,49 @@ ref<Bitmap> Texture::to_bitmap(uint32_t layer, uint32_t mip) const
         SGL_THROW("Unsupported channel bits.");
     Bitmap::ComponentType component_type = it2->second;
 
-    OwnedSubresourceData subresource_data = get_subresource_data(layer, mip);
+    return {pixel_format, component_type, info.is_srgb_format()};
+}
 
-    uint32_t width = get_mip_width(mip);
-    uint32_t height = get_mip_height(mip);
+} // namespace
 
-    ref<Bitmap> bitmap = ref<Bitmap>(new Bitmap(pixel_format, component_type, width, height));
-    bitmap->set_srgb_gamma(info.is_srgb_format());
+ref<Bitmap> Texture::to_bitmap(uint32_t layer, uint32_t mip) const
+{
+    SGL_CHECK_LT(layer, layer_count());
+    SGL_CHECK_LT(mip, mip_count());
+
+    BitmapFormat format = get_bitmap_format(m_desc);
 
-    // TODO would be better to avoid this extra copy
-    SGL_ASSERT(bitmap->buffer_size() == subresource_data.size);
-    std::memcpy(bitmap->data(), subresource_data.data, subresource_data.size);
+    ref<Bitmap> bitmap = ref<Bitmap>(
+        new Bitmap(format.pixel_format, format.component_type, get_mip_width(mip), get_mip_height(mip))
+    );
+    bitmap->set_srgb_gamma(format.srgb_gamma);
+
+    // Read directly into the bitmap storage.
+    get_subresource_data(layer, mip, bitmap->data(), bitmap->buffer_size());
 
     return bitmap;
 }
 
+void Texture::to_bitmap(Bitmap* bitmap, uint32_t layer, uint32_t mip) const
+{
+    SGL_CHECK_NOT_NULL(bitmap);
+    SGL_CHECK_LT(layer, layer_count());
+    SGL_CHECK_LT(mip, mip_count());
+
+    BitmapFormat format = get_bitmap_format(m_desc);
+    SGL_CHECK(
+        bitmap->pixel_format() == format.pixel_format && bitmap->component_type() == format.component_type,
+        "Bitmap format does not match texture format."
+    );
+    SGL_CHECK(
+        bitmap->width() == get_mip_width(mip) && bitmap->height() == get_mip_height(mip),
+        "Bitmap dimensions do not match texture dimensions."
+    );
+    bitmap->set_srgb_gamma(format.srgb_gamma);
+
+    get_subresource_data(layer, mip, bitmap->data(), bitmap->buffer_size());
+}
+
 std::string Texture::to_string() const
 {
     return fmt::format(
@@ -665,6 +741,11 @@ TextureView::TextureView(ref<Device> device, ref<Texture> texture, TextureViewDe
     );
 }
 
+TextureView::~TextureView()
+{
+    m_device->_deferred_release(m_rhi_texture_view);
+}
+
 NativeHandle TextureView::native_handle() const
 {
     rhi::NativeHandle rhi_handle = {};
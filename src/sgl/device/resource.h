@@ -7,6 +7,7 @@
 #include "sgl/device/device_resource.h"
 #include "sgl/device/formats.h"
 #include "sgl/device/native_handle.h"
+#include "sgl/device/memory_tracker.h"
 
 #include "sgl/core/fwd.h"
 #include "sgl/core/macros.h"
@@ -269,6 +270,12 @@ struct BufferDesc {
 
     /// Memory type.
     MemoryType memory_type{MemoryType::device_local};
+    /// Keep the buffer mapped for its whole lifetime.
+    /// Only valid for \c MemoryType::upload and \c MemoryType::read_back.
+    /// rhi exposes no explicit flush/invalidate, so persistent maps rely on host coherent memory:
+    /// host writes are visible to work submitted afterwards, and device writes are visible once
+    /// the submission writing them has finished.
+    bool persistent_map{false};
 
     /// Resource usage flags.
     BufferUsage usage{BufferUsage::none};
@@ -301,6 +308,7 @@ public:
 
     /// Map the whole buffer.
     /// Only available for buffers created with \c MemoryType::upload or \c MemoryType::read_back.
+    /// Returns the persistent mapping for buffers created with \c BufferDesc::persistent_map.
     void* map() const;
 
     template<typename T>
@@ -309,12 +317,15 @@ public:
         return reinterpret_cast<T*>(map());
     }
 
-    /// Unmap the buffer.
+    /// Unmap the buffer. No-op for persistently mapped buffers.
     void unmap() const;
 
     /// Returns true if buffer is currently mapped.
     bool is_mapped() const { return m_mapped_ptr != nullptr; }
 
+    /// Returns true if buffer is persistently mapped (see \c BufferDesc::persistent_map).
+    bool is_persistently_mapped() const { return m_desc.persistent_map; }
+
     /// Returns a pointer to the CUDA memory.
     /// This is only supported if the buffer was created with ResourceUsage::shared
     /// and the device has CUDA interop enabled.
@@ -382,6 +393,12 @@ public:
 
     MemoryUsage memory_usage() const override;
 
+    /// Memory tracker category (\c MemoryCategory::staging for upload and read back buffers).
+    MemoryCategory memory_category() const
+    {
+        return m_desc.memory_type == MemoryType::device_local ? MemoryCategory::buffer : MemoryCategory::staging;
+    }
+
     std::string to_string() const override;
 
 private:
@@ -579,6 +596,18 @@ public:
      */
     OwnedSubresourceData get_subresource_data(uint32_t layer, uint32_t mip) const;
 
+    /**
+     * Get subresource data into caller provided host memory.
+     * \note This will wait until the data is copied back to host memory.
+     *
+     * \param layer Layer index.
+     * \param mip Mip level.
+     * \param data Destination memory.
+     * \param size Size of the destination memory in bytes.
+     * \param row_pitch Destination row pitch in bytes (0 for tightly packed rows).
+     */
+    void get_subresource_data(uint32_t layer, uint32_t mip, void* data, size_t size, size_t row_pitch = 0) const;
+
     ref<TextureView> create_view(TextureViewDesc desc);
 
     /// Get the shared resource handle.
@@ -592,11 +621,23 @@ public:
 
     ref<Bitmap> to_bitmap(uint32_t layer = 0, uint32_t mip = 0) const;
 
+    /**
+     * Read the texture into a preallocated bitmap.
+     * The bitmap must match the pixel format, component type and dimensions of the subresource.
+     *
+     * \param bitmap Bitmap to write to.
+     * \param layer Layer index.
+     * \param mip Mip level.
+     */
+    void to_bitmap(Bitmap* bitmap, uint32_t layer = 0, uint32_t mip = 0) const;
+
     std::string to_string() const override;
 
 private:
     TextureDesc m_desc;
     Slang::ComPtr<rhi::ITexture> m_rhi_texture;
+    /// Memory registered with the device memory tracker.
+    size_t m_tracked_memory{0};
 };
 
 struct TextureViewDesc {
@@ -610,6 +651,7 @@ class SGL_API TextureView : public DeviceResource {
     SGL_OBJECT(TextureView)
 public:
     TextureView(ref<Device> device, ref<Texture> texture, TextureViewDesc desc);
+    ~TextureView();
 
     Texture* texture() const { return m_texture.get(); }
 
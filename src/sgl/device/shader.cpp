@@ -220,6 +220,7 @@ SlangSession::~SlangSession()
 void SlangSession::recreate_session()
 {
     SGL_CHECK_NOT_NULL(m_device);
+    std::lock_guard lock(m_device->_shader_compile_mutex());
 
     SlangSessionBuild build;
 
@@ -419,6 +420,13 @@ void SlangSession::create_session(SlangSessionBuild& build)
     // Add device print enable flag.
     session_options.add_macro_define("SGL_ENABLE_PRINT", m_device->desc().enable_print ? "1" : "0");
 
+    // Add bindless resource table enable flag and capacities.
+    const BindlessResourceTableDesc& bindless_desc = m_device->desc().bindless_desc;
+    session_options.add_macro_define("SGL_ENABLE_BINDLESS", m_device->desc().enable_bindless ? "1" : "0");
+    session_options.add_macro_define("SGL_BINDLESS_TEXTURE_COUNT", fmt::format("{}", bindless_desc.texture_capacity));
+    session_options.add_macro_define("SGL_BINDLESS_BUFFER_COUNT", fmt::format("{}", bindless_desc.buffer_capacity));
+    session_options.add_macro_define("SGL_BINDLESS_SAMPLER_COUNT", fmt::format("{}", bindless_desc.sampler_capacity));
+
     auto slang_target_option_entries = target_options.slang_entries();
     target_desc.compilerOptionEntries = slang_target_option_entries.data();
     target_desc.compilerOptionEntryCount = narrow_cast<uint32_t>(slang_target_option_entries.size());
@@ -467,6 +475,8 @@ void SlangSession::create_session(SlangSessionBuild& build)
 
 ref<SlangModule> SlangSession::load_module(std::string_view module_name)
 {
+    std::lock_guard lock(m_device->_shader_compile_mutex());
+
     SlangModuleDesc desc;
     desc.module_name = module_name;
 
@@ -490,6 +500,8 @@ ref<SlangModule> SlangSession::load_module_from_source(
     std::optional<std::filesystem::path> path
 )
 {
+    std::lock_guard lock(m_device->_shader_compile_mutex());
+
     SlangModuleDesc desc;
     desc.module_name = module_name;
     desc.source = source;
@@ -515,6 +527,8 @@ ref<ShaderProgram> SlangSession::link_program(
     std::optional<SlangLinkOptions> link_options
 )
 {
+    std::lock_guard lock(m_device->_shader_compile_mutex());
+
     for (const auto& module : modules)
         SGL_CHECK(module->session() == this, "All modules must belong to this session.");
     for (const auto& entry_point : entry_points)
@@ -569,6 +583,8 @@ ref<ShaderProgram> SlangSession::load_program(
 
 std::string SlangSession::load_source(std::string_view module_name)
 {
+    std::lock_guard lock(m_device->_shader_compile_mutex());
+
     std::string resolved_name = m_data->resolve_module_name(module_name);
 
     for (const std::filesystem::path& include_path : m_data->include_paths) {
@@ -586,16 +602,19 @@ std::string SlangSession::load_source(std::string_view module_name)
 
 void SlangSession::_register_program(ShaderProgram* program)
 {
+    std::lock_guard lock(m_device->_shader_compile_mutex());
     m_registered_programs.insert(program);
 }
 
 void SlangSession::_unregister_program(ShaderProgram* program)
 {
+    std::lock_guard lock(m_device->_shader_compile_mutex());
     m_registered_programs.erase(program);
 }
 
 void SlangSession::_register_module(SlangModule* module)
 {
+    std::lock_guard lock(m_device->_shader_compile_mutex());
     auto existing = std::find(m_registered_modules.begin(), m_registered_modules.end(), module);
     if (existing == m_registered_modules.end())
         m_registered_modules.push_back(module);
@@ -603,6 +622,7 @@ void SlangSession::_register_module(SlangModule* module)
 
 void SlangSession::_unregister_module(SlangModule* module)
 {
+    std::lock_guard lock(m_device->_shader_compile_mutex());
     auto existing = std::find(m_registered_modules.begin(), m_registered_modules.end(), module);
     if (existing != m_registered_modules.end())
         m_registered_modules.erase(existing);
@@ -847,6 +867,8 @@ std::vector<ref<SlangEntryPoint>> SlangModule::entry_points() const
 
 ref<SlangEntryPoint> SlangModule::entry_point(std::string_view name, std::span<TypeConformance> type_conformances) const
 {
+    std::lock_guard lock(m_session->device()->_shader_compile_mutex());
+
     SlangEntryPointDesc desc;
     desc.name = name;
     desc.type_conformances.assign(type_conformances.begin(), type_conformances.end());
@@ -1083,6 +1105,8 @@ ShaderProgram::ShaderProgram(ref<Device> device, ref<SlangSession> session, cons
 
 ShaderProgram::~ShaderProgram()
 {
+    if (m_device->bindless_table())
+        m_device->bindless_table()->_release_program(this);
     m_session->_unregister_program(this);
 }
 
@@ -1210,6 +1234,9 @@ void ShaderProgram::store_built_data(SlangSessionBuild& build_data)
     // Store built program data
     m_data = build_data.programs[this];
 
+    // Flattened type layouts refer to the layout of the linked program, start with a new cache.
+    m_flat_layouts = make_ref<FlatTypeLayoutCache>(m_data);
+
     // Notify all registered pipelines that this program has rebuilt.
     for (auto pipeline : m_registered_pipelines)
         pipeline->notify_program_reloaded();
@@ -501,6 +501,9 @@ public:
 
     rhi::IShaderProgram* rhi_shader_program() const { return m_data->rhi_shader_program; }
 
+    /// Cache of flattened type layouts of the linked program. Replaced when the program is rebuilt.
+    const ref<FlatTypeLayoutCache>& _flat_layouts() const { return m_flat_layouts; }
+
     virtual std::string to_string() const override;
 
     void _register_pipeline(Pipeline* pipeline);
@@ -510,6 +513,7 @@ private:
     ref<SlangSession> m_session;
     ShaderProgramDesc m_desc;
     ref<ShaderProgramData> m_data;
+    ref<FlatTypeLayoutCache> m_flat_layouts;
     std::set<Pipeline*> m_registered_pipelines;
 };
 
@@ -13,15 +13,11 @@
 #include "sgl/math/vector_types.h"
 #include "sgl/math/matrix_types.h"
 
-// TODO: Decide if we want to disable / optimize type checks
-// currently can represent 50% of the cost of writes in
-// certain situations.
-#define SGL_ENABLE_CURSOR_TYPE_CHECKS
-
 namespace sgl {
 
 ShaderCursor::ShaderCursor(ShaderObject* shader_object)
     : m_type_layout(shader_object->slang_element_type_layout())
+    , m_layout(shader_object->_flat_layouts()->get(m_type_layout))
     , m_shader_object(shader_object)
     , m_offset(ShaderOffset::zero())
 {
@@ -37,7 +33,7 @@ std::string ShaderCursor::to_string() const
 
 bool ShaderCursor::is_reference() const
 {
-    switch ((TypeReflection::Kind)m_type_layout->getKind()) {
+    switch (m_layout->kind) {
     case TypeReflection::Kind::constant_buffer:
     case TypeReflection::Kind::parameter_block:
         return true;
@@ -49,7 +45,7 @@ bool ShaderCursor::is_reference() const
 ShaderCursor ShaderCursor::dereference() const
 {
     SGL_CHECK(is_valid(), "Invalid cursor");
-    switch ((TypeReflection::Kind)m_type_layout->getKind()) {
+    switch (m_layout->kind) {
     case TypeReflection::Kind::constant_buffer:
     case TypeReflection::Kind::parameter_block:
         return ShaderCursor(m_shader_object->get_object(m_offset));
@@ -86,7 +82,7 @@ ShaderCursor ShaderCursor::find_field(std::string_view name) const
     // If the cursor is valid, we want to consider the type of data
     // it is referencing.
     //
-    switch ((TypeReflection::Kind)m_type_layout->getKind()) {
+    switch (m_layout->kind) {
         // The easy/expected case is when the value has a structure type.
         //
     case TypeReflection::Kind::struct_: {
@@ -94,8 +90,8 @@ ShaderCursor ShaderCursor::find_field(std::string_view name) const
         //
         // If there is no such field, we have an error.
         //
-        int32_t field_index = (int32_t)m_type_layout->findFieldIndexByName(name.data(), name.data() + name.size());
-        if (field_index < 0)
+        const FlatTypeLayout::Field* field = m_layout->find_field(name);
+        if (!field)
             break;
 
         // Once we know the index of the field being referenced,
@@ -103,7 +99,6 @@ ShaderCursor ShaderCursor::find_field(std::string_view name) const
         // the offset information already in this cursor, plus
         // offsets derived from the field's layout.
         //
-        slang::VariableLayoutReflection* field_layout = m_type_layout->getFieldByIndex(field_index);
         ShaderCursor field_cursor;
 
         // The field cursor will point into the same parent object.
@@ -112,15 +107,14 @@ ShaderCursor ShaderCursor::find_field(std::string_view name) const
 
         // The type being pointed to is the type of the field.
         //
-        field_cursor.m_type_layout = field_layout->getTypeLayout();
+        field_cursor.m_type_layout = field->type_layout;
+        field_cursor.m_layout = field->layout;
 
         // The byte offset is the current offset plus the relative offset of the field.
         // The offset in binding ranges is computed similarly.
         //
-        field_cursor.m_offset.uniform_offset
-            = m_offset.uniform_offset + narrow_cast<uint32_t>(field_layout->getOffset());
-        field_cursor.m_offset.binding_range_index = m_offset.binding_range_index
-            + narrow_cast<int32_t>(m_type_layout->getFieldBindingRangeOffset(field_index));
+        field_cursor.m_offset.uniform_offset = m_offset.uniform_offset + field->uniform_offset;
+        field_cursor.m_offset.binding_range_index = m_offset.binding_range_index + field->binding_range_offset;
 
         // The index of the field within any binding ranges will be the same
         // as the index computed for the parent structure.
@@ -213,19 +207,16 @@ ShaderCursor ShaderCursor::find_element(uint32_t index) const
     }
 #endif
 
-    switch ((TypeReflection::Kind)m_type_layout->getKind()) {
+    switch (m_layout->kind) {
     case TypeReflection::Kind::array: {
         ShaderCursor element_cursor;
         element_cursor.m_shader_object = m_shader_object;
-        element_cursor.m_type_layout = m_type_layout->getElementTypeLayout();
-        element_cursor.m_offset.uniform_offset = m_offset.uniform_offset
-            + index
-                * narrow_cast<uint32_t>(
-                    m_type_layout->getElementStride(SlangParameterCategory::SLANG_PARAMETER_CATEGORY_UNIFORM)
-                );
+        element_cursor.m_type_layout = m_layout->element_type_layout;
+        element_cursor.m_layout = m_layout->element_layout;
+        element_cursor.m_offset.uniform_offset = m_offset.uniform_offset + index * m_layout->element_stride;
         element_cursor.m_offset.binding_range_index = m_offset.binding_range_index;
         element_cursor.m_offset.binding_array_index
-            = m_offset.binding_array_index * narrow_cast<uint32_t>(m_type_layout->getElementCount()) + index;
+            = m_offset.binding_array_index * narrow_cast<uint32_t>(m_layout->element_count) + index;
         return element_cursor;
     } break;
 
@@ -233,9 +224,9 @@ ShaderCursor ShaderCursor::find_element(uint32_t index) const
     case TypeReflection::Kind::matrix: {
         ShaderCursor field_cursor;
         field_cursor.m_shader_object = m_shader_object;
-        field_cursor.m_type_layout = m_type_layout->getElementTypeLayout();
-        field_cursor.m_offset.uniform_offset = m_offset.uniform_offset
-            + narrow_cast<uint32_t>(m_type_layout->getElementStride(SLANG_PARAMETER_CATEGORY_UNIFORM)) * index;
+        field_cursor.m_type_layout = m_layout->element_type_layout;
+        field_cursor.m_layout = m_layout->element_layout;
+        field_cursor.m_offset.uniform_offset = m_offset.uniform_offset + m_layout->element_stride * index;
         field_cursor.m_offset.binding_range_index = m_offset.binding_range_index;
         field_cursor.m_offset.binding_array_index = m_offset.binding_array_index;
         return field_cursor;
@@ -413,8 +404,7 @@ void ShaderCursor::set_acceleration_structure(const ref<AccelerationStructure>&
 
 void ShaderCursor::set_data(const void* data, size_t size) const
 {
-    if ((TypeReflection::ParameterCategory)m_type_layout->getParameterCategory()
-        != TypeReflection::ParameterCategory::uniform)
+    if (m_layout->parameter_category != TypeReflection::ParameterCategory::uniform)
         SGL_THROW("\"{}\" cannot bind data", m_type_layout->getName());
     m_shader_object->set_data(m_offset, data, size);
 }
@@ -450,17 +440,15 @@ void ShaderCursor::_set_array(
     size_t element_count
 ) const
 {
-    slang::TypeReflection* element_type = cursor_utils::unwrap_array(m_type_layout)->getType();
-    size_t element_size = cursor_utils::get_scalar_type_size((TypeReflection::ScalarType)element_type->getScalarType());
+    size_t element_size = cursor_utils::get_scalar_type_size(m_layout->leaf_scalar_type);
 
-#ifdef SGL_ENABLE_CURSOR_TYPE_CHECKS
-    cursor_utils::check_array(m_type_layout, size, scalar_type, element_count);
-#else
-    SGL_UNUSED(scalar_type);
-    SGL_UNUSED(element_count);
-#endif
+    cursor_utils::check_cached(
+        m_layout,
+        cursor_utils::value_type_key(TypeReflection::Kind::array, scalar_type, 0, 0, size),
+        [&] { cursor_utils::check_array(m_layout, size, scalar_type, element_count); }
+    );
 
-    size_t stride = m_type_layout->getElementStride(SLANG_PARAMETER_CATEGORY_UNIFORM);
+    size_t stride = m_layout->element_stride;
     if (element_size == stride) {
         m_shader_object->set_data(m_offset, data, size);
     } else {
@@ -474,10 +462,9 @@ void ShaderCursor::_set_array(
 
 void ShaderCursor::_set_array_unsafe(const void* data, size_t size, size_t element_count) const
 {
-    slang::TypeReflection* element_type = cursor_utils::unwrap_array(m_type_layout)->getType();
-    size_t element_size = cursor_utils::get_scalar_type_size((TypeReflection::ScalarType)element_type->getScalarType());
+    size_t element_size = cursor_utils::get_scalar_type_size(m_layout->leaf_scalar_type);
 
-    size_t stride = m_type_layout->getElementStride(SLANG_PARAMETER_CATEGORY_UNIFORM);
+    size_t stride = m_layout->element_stride;
     if (element_size == stride) {
         m_shader_object->set_data(m_offset, data, size);
     } else {
@@ -491,23 +478,22 @@ void ShaderCursor::_set_array_unsafe(const void* data, size_t size, size_t eleme
 
 void ShaderCursor::_set_scalar(const void* data, size_t size, TypeReflection::ScalarType scalar_type) const
 {
-#ifdef SGL_ENABLE_CURSOR_TYPE_CHECKS
-    cursor_utils::check_scalar(m_type_layout, size, scalar_type);
-#else
-    SGL_UNUSED(scalar_type);
-#endif
+    cursor_utils::check_cached(
+        m_layout,
+        cursor_utils::value_type_key(TypeReflection::Kind::scalar, scalar_type, 1, 1, size),
+        [&] { cursor_utils::check_scalar(m_layout, size, scalar_type); }
+    );
     m_shader_object->set_data(m_offset, data, size);
 }
 
 void ShaderCursor::_set_vector(const void* data, size_t size, TypeReflection::ScalarType scalar_type, int dimension)
     const
 {
-#ifdef SGL_ENABLE_CURSOR_TYPE_CHECKS
-    cursor_utils::check_vector(m_type_layout, size, scalar_type, dimension);
-#else
-    SGL_UNUSED(scalar_type);
-    SGL_UNUSED(dimension);
-#endif
+    cursor_utils::check_cached(
+        m_layout,
+        cursor_utils::value_type_key(TypeReflection::Kind::vector, scalar_type, 1, dimension, size),
+        [&] { cursor_utils::check_vector(m_layout, size, scalar_type, dimension); }
+    );
     m_shader_object->set_data(m_offset, data, size);
 }
 
@@ -519,13 +505,16 @@ void ShaderCursor::_set_matrix(
     int cols
 ) const
 {
-#ifdef SGL_ENABLE_CURSOR_TYPE_CHECKS
-    cursor_utils::check_matrix(m_type_layout, size, scalar_type, rows, cols);
-#else
-    SGL_UNUSED(scalar_type);
-    SGL_UNUSED(cols);
-#endif
+    cursor_utils::check_cached(
+        m_layout,
+        cursor_utils::value_type_key(TypeReflection::Kind::matrix, scalar_type, rows, cols, size),
+        [&] { cursor_utils::check_matrix(m_layout, size, scalar_type, rows, cols); }
+    );
+    _set_unchecked(data, size, rows);
+}
 
+void ShaderCursor::_set_unchecked(const void* data, size_t size, int rows) const
+{
     if (rows > 1) {
         // each row is aligned to 16 bytes
         size_t row_size = size / rows;
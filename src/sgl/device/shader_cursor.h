@@ -25,6 +25,8 @@ public:
 
     ShaderCursor(ShaderObject* shader_object);
 
+    ShaderObject* shader_object() const { return m_shader_object; }
+
     ShaderOffset offset() const { return m_offset; }
 
     bool is_valid() const { return m_offset.is_valid(); }
@@ -37,6 +39,9 @@ public:
 
     slang::TypeLayoutReflection* slang_type_layout() const { return m_type_layout; }
 
+    /// Flattened layout of the type the cursor points to.
+    const FlatTypeLayout* _flat_layout() const { return m_layout; }
+
     //
     // Navigation
     //
@@ -78,15 +83,35 @@ public:
     template<typename T>
     void set(const T& value) const;
 
+    /**
+     * Write a scalar, vector or matrix value without type checks.
+     *
+     * The copy (including the row padding of matrices) is resolved at compile time from \c T,
+     * so this is a plain copy into the shader object. The caller is responsible for \c T
+     * matching the field type. With \c SGL_ENABLE_CURSOR_DEBUG_CHECKS, this behaves like \c set.
+     */
+    template<typename T>
+    void set_unchecked(const T& value) const
+    {
+#if SGL_ENABLE_CURSOR_DEBUG_CHECKS
+        set(value);
+#else
+        _set_unchecked(&value, sizeof(T), CursorValueTraits<T>::rows);
+#endif
+    }
+
     void _set_array(const void* data, size_t size, TypeReflection::ScalarType scalar_type, size_t element_count) const;
     void _set_array_unsafe(const void* data, size_t size, size_t element_count) const;
 
     void _set_scalar(const void* data, size_t size, TypeReflection::ScalarType scalar_type) const;
     void _set_vector(const void* data, size_t size, TypeReflection::ScalarType scalar_type, int dimension) const;
     void _set_matrix(const void* data, size_t size, TypeReflection::ScalarType scalar_type, int rows, int cols) const;
+    void _set_unchecked(const void* data, size_t size, int rows) const;
 
 private:
     slang::TypeLayoutReflection* m_type_layout;
+    /// Flattened layout of \c m_type_layout, used on the hot path instead of querying slang.
+    const FlatTypeLayout* m_layout{nullptr};
     ShaderObject* m_shader_object{nullptr};
     ShaderOffset m_offset;
 };
@@ -11,6 +11,9 @@
 #include "sgl/device/device.h"
 #include "sgl/device/cuda_interop.h"
 
+#include <algorithm>
+#include <cstring>
+
 namespace sgl {
 
 inline rhi::ShaderOffset rhi_shader_offset(const ShaderOffset& offset)
@@ -22,26 +25,63 @@ inline rhi::ShaderOffset rhi_shader_offset(const ShaderOffset& offset)
     };
 }
 
+/// Add the range [begin, end) to a sorted list of non-overlapping ranges,
+/// merging it with all overlapping or adjacent ranges.
+static void add_data_range(std::vector<std::pair<size_t, size_t>>& ranges, size_t begin, size_t end)
+{
+    auto first = std::lower_bound(
+        ranges.begin(),
+        ranges.end(),
+        begin,
+        [](const std::pair<size_t, size_t>& range, size_t value) { return range.second < value; }
+    );
+    auto last = first;
+    while (last != ranges.end() && last->first <= end) {
+        begin = std::min(begin, last->first);
+        end = std::max(end, last->second);
+        ++last;
+    }
+    first = ranges.erase(first, last);
+    ranges.insert(first, {begin, end});
+}
+
 //
 // ShaderObject
 //
 
-ShaderObject::ShaderObject(ref<Device> device, rhi::IShaderObject* shader_object, bool retain)
+ShaderObject::ShaderObject(
+    ref<Device> device,
+    rhi::IShaderObject* shader_object,
+    bool retain,
+    ref<FlatTypeLayoutCache> flat_layouts
+)
     : m_device(std::move(device))
     , m_shader_object(shader_object)
     , m_retain(retain)
-
+    , m_flat_layouts(std::move(flat_layouts))
 {
     if (m_retain)
         m_shader_object->addRef();
+    if (!m_flat_layouts)
+        m_flat_layouts = make_ref<FlatTypeLayoutCache>();
 }
 
 ShaderObject::~ShaderObject()
 {
+    if (m_memory_tracked)
+        m_device->memory_tracker().untrack(MemoryCategory::shader_object, {}, m_tracked_memory);
     if (m_retain)
         m_shader_object->release();
 }
 
+void ShaderObject::_track_memory(size_t size)
+{
+    SGL_ASSERT(!m_memory_tracked);
+    m_memory_tracked = true;
+    m_tracked_memory = size;
+    m_device->memory_tracker().track(MemoryCategory::shader_object, {}, m_tracked_memory);
+}
+
 ref<const TypeLayoutReflection> ShaderObject::element_type_layout() const
 {
     return TypeLayoutReflection::from_slang(ref(this), slang_element_type_layout());
@@ -59,7 +99,8 @@ uint32_t ShaderObject::get_entry_point_count() const
 
 ref<ShaderObject> ShaderObject::get_entry_point(uint32_t index)
 {
-    ref<ShaderObject> shader_object = make_ref<ShaderObject>(m_device, m_shader_object->getEntryPoint(index));
+    ref<ShaderObject> shader_object
+        = make_ref<ShaderObject>(m_device, m_shader_object->getEntryPoint(index), true, m_flat_layouts);
     // TODO(slang-rhi) this is required to keep shader object's alive (shader cursor uses weak references)
     m_objects.insert(shader_object);
     return shader_object;
@@ -67,8 +108,12 @@ ref<ShaderObject> ShaderObject::get_entry_point(uint32_t index)
 
 ref<ShaderObject> ShaderObject::get_object(const ShaderOffset& offset)
 {
-    ref<ShaderObject> shader_object
-        = make_ref<ShaderObject>(m_device, m_shader_object->getObject(rhi_shader_offset(offset)));
+    ref<ShaderObject> shader_object = make_ref<ShaderObject>(
+        m_device,
+        m_shader_object->getObject(rhi_shader_offset(offset)),
+        true,
+        m_flat_layouts
+    );
     // TODO(slang-rhi) this is required to keep shader object's alive (shader cursor uses weak references)
     m_objects.insert(shader_object);
     return shader_object;
@@ -132,13 +177,87 @@ void ShaderObject::set_acceleration_structure(
 
 void ShaderObject::set_data(const ShaderOffset& offset, const void* data, size_t size)
 {
-    SLANG_CALL(m_shader_object->setData(rhi_shader_offset(offset), data, size));
+    m_stats.write_count++;
+    m_stats.write_size += size;
+
+    if (!m_shadow_copy_enabled || size == 0) {
+        SLANG_CALL(m_shader_object->setData(rhi_shader_offset(offset), data, size));
+        return;
+    }
+
+    size_t begin = offset.uniform_offset;
+    size_t end = begin + size;
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    if (m_shadow_data.size() < end)
+        m_shadow_data.resize(end);
+    uint8_t* shadow = m_shadow_data.data() + begin;
+
+    auto upload = [&](size_t run_begin, size_t run_end)
+    {
+        std::memcpy(shadow + run_begin, bytes + run_begin, run_end - run_begin);
+        ShaderOffset upload_offset = offset;
+        upload_offset.uniform_offset = narrow_cast<uint32_t>(begin + run_begin);
+        SLANG_CALL(
+            m_shader_object->setData(rhi_shader_offset(upload_offset), bytes + run_begin, run_end - run_begin)
+        );
+    };
+
+    // Bytes that were never written are always uploaded.
+    auto it = std::upper_bound(
+        m_shadow_ranges.begin(),
+        m_shadow_ranges.end(),
+        begin,
+        [](size_t value, const std::pair<size_t, size_t>& range) { return value < range.first; }
+    );
+    if (it == m_shadow_ranges.begin() || std::prev(it)->second < end) {
+        upload(0, size);
+        add_data_range(m_shadow_ranges, begin, end);
+        return;
+    }
+
+    // Upload each run of changed bytes. Runs separated by less than MIN_SKIPPED_GAP unchanged
+    // bytes are merged, as skipping a few bytes is not worth an additional upload.
+    static constexpr size_t MIN_SKIPPED_GAP = 16;
+    size_t uploaded_size = 0;
+    for (size_t i = 0; i < size;) {
+        if (shadow[i] == bytes[i]) {
+            i++;
+            continue;
+        }
+        size_t run_end = i + 1;
+        for (size_t j = run_end; j < size && j < run_end + MIN_SKIPPED_GAP; ++j)
+            if (shadow[j] != bytes[j])
+                run_end = j + 1;
+        upload(i, run_end);
+        uploaded_size += run_end - i;
+        i = run_end;
+    }
+
+    m_stats.skipped_size += size - uploaded_size;
+    if (uploaded_size == 0)
+        m_stats.skipped_write_count++;
+}
+
+void ShaderObject::set_shadow_copy_enabled(bool enabled)
+{
+    m_shadow_copy_enabled = enabled;
+    if (!enabled) {
+        m_shadow_data = {};
+        m_shadow_ranges = {};
+    }
 }
 
 void ShaderObject::set_cuda_tensor_view(const ShaderOffset& offset, const cuda::TensorView& tensor_view, bool is_uav)
 {
     SGL_CHECK(m_device->supports_cuda_interop(), "Device does not support CUDA interop");
-    ref<cuda::InteropBuffer> cuda_interop_buffer = make_ref<cuda::InteropBuffer>(m_device, tensor_view, is_uav);
+    _set_cuda_interop_buffer(offset, make_ref<cuda::InteropBuffer>(m_device, tensor_view, is_uav));
+}
+
+void ShaderObject::_set_cuda_interop_buffer(
+    const ShaderOffset& offset,
+    const ref<cuda::InteropBuffer>& cuda_interop_buffer
+)
+{
     set_buffer(offset, cuda_interop_buffer->buffer());
     m_cuda_interop_buffers.push_back(cuda_interop_buffer);
 }
@@ -149,4 +268,196 @@ void ShaderObject::get_cuda_interop_buffers(std::vector<ref<cuda::InteropBuffer>
         .insert(cuda_interop_buffers.end(), m_cuda_interop_buffers.begin(), m_cuda_interop_buffers.end());
 }
 
+//
+// PersistentShaderObject
+//
+
+PersistentShaderObject::PersistentShaderObject(ref<ShaderObject> layout_object)
+    : ShaderObject(
+          ref<Device>(layout_object->device()),
+          layout_object->rhi_shader_object(),
+          true,
+          layout_object->_flat_layouts()
+      )
+    , m_layout_object(std::move(layout_object))
+{
+}
+
+PersistentShaderObject::~PersistentShaderObject() { }
+
+ref<ShaderObject> PersistentShaderObject::get_entry_point(uint32_t index)
+{
+    auto it = m_entry_points.find(index);
+    if (it == m_entry_points.end())
+        it = m_entry_points
+                 .emplace(index, make_ref<PersistentShaderObject>(m_layout_object->get_entry_point(index)))
+                 .first;
+    return it->second;
+}
+
+ref<ShaderObject> PersistentShaderObject::get_object(const ShaderOffset& offset)
+{
+    auto it = m_sub_objects.find(offset);
+    if (it == m_sub_objects.end()) {
+        // Writes to the sub-object replace an object that was explicitly bound at this offset.
+        m_bindings.erase(offset);
+        it = m_sub_objects.emplace(offset, make_ref<PersistentShaderObject>(m_layout_object->get_object(offset)))
+                 .first;
+    }
+    return it->second;
+}
+
+void PersistentShaderObject::set_object(const ShaderOffset& offset, const ref<ShaderObject>& object)
+{
+    m_sub_objects.erase(offset);
+    set_binding(offset, object);
+}
+
+void PersistentShaderObject::set_buffer(const ShaderOffset& offset, const ref<Buffer>& buffer)
+{
+    set_binding(offset, buffer);
+}
+
+void PersistentShaderObject::set_buffer_view(const ShaderOffset& offset, const ref<BufferView>& buffer_view)
+{
+    set_binding(offset, buffer_view);
+}
+
+void PersistentShaderObject::set_texture(const ShaderOffset& offset, const ref<Texture>& texture)
+{
+    set_binding(offset, texture);
+}
+
+void PersistentShaderObject::set_texture_view(const ShaderOffset& offset, const ref<TextureView>& texture_view)
+{
+    set_binding(offset, texture_view);
+}
+
+void PersistentShaderObject::set_sampler(const ShaderOffset& offset, const ref<Sampler>& sampler)
+{
+    set_binding(offset, sampler);
+}
+
+void PersistentShaderObject::set_acceleration_structure(
+    const ShaderOffset& offset,
+    const ref<AccelerationStructure>& acceleration_structure
+)
+{
+    set_binding(offset, acceleration_structure);
+}
+
+void PersistentShaderObject::set_data(const ShaderOffset& offset, const void* data, size_t size)
+{
+    SGL_CHECK(offset.is_valid(), "Invalid shader offset.");
+    if (size == 0)
+        return;
+
+    size_t begin = offset.uniform_offset;
+    size_t end = begin + size;
+    if (m_data.size() < end)
+        m_data.resize(end);
+    std::memcpy(m_data.data() + begin, data, size);
+
+    add_data_range(m_data_ranges, begin, end);
+}
+
+void PersistentShaderObject::set_cuda_tensor_view(
+    const ShaderOffset& offset,
+    const cuda::TensorView& tensor_view,
+    bool is_uav
+)
+{
+    SGL_CHECK(m_device->supports_cuda_interop(), "Device does not support CUDA interop");
+    set_binding(offset, make_ref<cuda::InteropBuffer>(m_device, tensor_view, is_uav));
+}
+
+void PersistentShaderObject::get_cuda_interop_buffers(
+    std::vector<ref<cuda::InteropBuffer>>& cuda_interop_buffers
+) const
+{
+    for (const auto& [offset, binding] : m_bindings)
+        if (auto cuda_interop_buffer = std::get_if<ref<cuda::InteropBuffer>>(&binding))
+            cuda_interop_buffers.push_back(*cuda_interop_buffer);
+    for (const auto& [index, entry_point] : m_entry_points)
+        entry_point->get_cuda_interop_buffers(cuda_interop_buffers);
+    for (const auto& [offset, sub_object] : m_sub_objects)
+        sub_object->get_cuda_interop_buffers(cuda_interop_buffers);
+}
+
+void PersistentShaderObject::apply(ShaderObject* target) const
+{
+    SGL_CHECK_NOT_NULL(target);
+
+    for (const auto& [begin, end] : m_data_ranges)
+        target->set_data(ShaderOffset(narrow_cast<uint32_t>(begin), 0, 0), m_data.data() + begin, end - begin);
+
+    for (const auto& [offset, binding] : m_bindings) {
+        std::visit(
+            [&](const auto& resource)
+            {
+                using T = std::decay_t<decltype(resource)>;
+                if constexpr (std::is_same_v<T, ref<Buffer>>)
+                    target->set_buffer(offset, resource);
+                else if constexpr (std::is_same_v<T, ref<BufferView>>)
+                    target->set_buffer_view(offset, resource);
+                else if constexpr (std::is_same_v<T, ref<Texture>>)
+                    target->set_texture(offset, resource);
+                else if constexpr (std::is_same_v<T, ref<TextureView>>)
+                    target->set_texture_view(offset, resource);
+                else if constexpr (std::is_same_v<T, ref<Sampler>>)
+                    target->set_sampler(offset, resource);
+                else if constexpr (std::is_same_v<T, ref<AccelerationStructure>>)
+                    target->set_acceleration_structure(offset, resource);
+                else if constexpr (std::is_same_v<T, ref<ShaderObject>>)
+                    target->set_object(offset, resource);
+                else if constexpr (std::is_same_v<T, ref<cuda::InteropBuffer>>)
+                    target->_set_cuda_interop_buffer(offset, resource);
+            },
+            binding
+        );
+    }
+
+    for (const auto& [index, entry_point] : m_entry_points)
+        entry_point->apply(target->get_entry_point(index));
+
+    for (const auto& [offset, sub_object] : m_sub_objects)
+        target->set_object(offset, sub_object->materialize());
+}
+
+const ref<ShaderObject>& PersistentShaderObject::materialize() const
+{
+    // Sub-objects are replayed into a shader object that is kept across replays and bound to
+    // each target. With the shadow copy enabled, only uniform data that changed is uploaded.
+    if (!m_materialized) {
+        m_materialized = m_device->create_shader_object(m_layout_object->element_type_layout().get());
+        m_materialized->set_shadow_copy_enabled(true);
+    }
+    apply(m_materialized);
+    return m_materialized;
+}
+
+void PersistentShaderObject::clear()
+{
+    m_data.clear();
+    m_data_ranges.clear();
+    m_bindings.clear();
+    // Entry points and sub-objects are kept alive, as shader cursors may still reference them.
+    for (const auto& [index, entry_point] : m_entry_points)
+        entry_point->clear();
+    for (const auto& [offset, sub_object] : m_sub_objects)
+        sub_object->clear();
+    m_materialized = nullptr;
+}
+
+size_t PersistentShaderObject::uniform_data_size() const
+{
+    return m_data.size();
+}
+
+void PersistentShaderObject::set_binding(const ShaderOffset& offset, Binding binding)
+{
+    SGL_CHECK(offset.is_valid(), "Invalid shader offset.");
+    m_bindings.insert_or_assign(offset, std::move(binding));
+}
+
 } // namespace sgl
@@ -8,20 +8,43 @@
 
 #include "sgl/device/fwd.h"
 #include "sgl/device/shader_offset.h"
+#include "sgl/device/reflection.h"
 #include "sgl/device/resource.h"
 
 #include <slang-rhi.h>
 
+#include <map>
 #include <string_view>
+#include <utility>
+#include <variant>
 #include <vector>
 #include <set>
 
 namespace sgl {
 
+struct ShaderObjectStats {
+    /// Number of \c set_data calls.
+    uint64_t write_count{0};
+    /// Number of \c set_data calls that were skipped entirely because the data was unchanged.
+    uint64_t skipped_write_count{0};
+    /// Number of bytes passed to \c set_data.
+    uint64_t write_size{0};
+    /// Number of bytes that were not uploaded because they were unchanged.
+    uint64_t skipped_size{0};
+};
+
 class SGL_API ShaderObject : public Object {
     SGL_OBJECT(ShaderObject)
 public:
-    ShaderObject(ref<Device> device, rhi::IShaderObject* shader_object, bool retain = true);
+    /// Constructor.
+    /// \param flat_layouts Cache of flattened type layouts of the shader object's layout, shared with
+    ///     sub-objects. A new cache is created if not provided.
+    ShaderObject(
+        ref<Device> device,
+        rhi::IShaderObject* shader_object,
+        bool retain = true,
+        ref<FlatTypeLayoutCache> flat_layouts = nullptr
+    );
     virtual ~ShaderObject();
 
     Device* device() const { return m_device.get(); }
@@ -48,14 +71,136 @@ public:
     virtual void set_cuda_tensor_view(const ShaderOffset& offset, const cuda::TensorView& tensor_view, bool is_uav);
     virtual void get_cuda_interop_buffers(std::vector<ref<cuda::InteropBuffer>>& cuda_interop_buffers) const;
 
+    /**
+     * Enable or disable the shadow copy of the uniform data.
+     *
+     * With the shadow copy enabled, data passed to \c set_data is compared against the data
+     * that was last written to the same bytes. Only runs of changed bytes are uploaded (runs
+     * separated by less than 16 unchanged bytes are merged) and writes without any changes
+     * are skipped, so an object that is kept around and updated with the same values every
+     * frame is never modified. Bytes that were never written are always uploaded.
+     * Disabling the shadow copy releases it.
+     */
+    void set_shadow_copy_enabled(bool enabled);
+
+    /// True if the shadow copy of the uniform data is enabled.
+    bool shadow_copy_enabled() const { return m_shadow_copy_enabled; }
+
+    /// Statistics about uniform data writes.
+    const ShaderObjectStats& stats() const { return m_stats; }
+
+    /// Reset the statistics about uniform data writes.
+    void reset_stats() { m_stats = {}; }
+
     rhi::IShaderObject* rhi_shader_object() const { return m_shader_object; }
 
+    /// Cache of flattened type layouts used by shader cursors on this object.
+    const ref<FlatTypeLayoutCache>& _flat_layouts() const { return m_flat_layouts; }
+
+    /// Bind the buffer of a CUDA interop buffer and keep the interop buffer with this shader object.
+    void _set_cuda_interop_buffer(const ShaderOffset& offset, const ref<cuda::InteropBuffer>& cuda_interop_buffer);
+
+    /// Register the uniform data of this shader object with the device memory tracker.
+    /// Called by the device for shader objects it creates.
+    void _track_memory(size_t size);
+
 protected:
     ref<Device> m_device;
     rhi::IShaderObject* m_shader_object;
     bool m_retain;
+    ref<FlatTypeLayoutCache> m_flat_layouts;
+    bool m_memory_tracked{false};
+    size_t m_tracked_memory{0};
     std::vector<ref<cuda::InteropBuffer>> m_cuda_interop_buffers;
     std::set<ref<ShaderObject>> m_objects;
+    ShaderObjectStats m_stats;
+    bool m_shadow_copy_enabled{false};
+    /// Uniform data last written to the shader object (shadow copy).
+    std::vector<uint8_t> m_shadow_data;
+    /// Sorted, non-overlapping ranges [begin, end) of \c m_shadow_data that were written.
+    std::vector<std::pair<size_t, size_t>> m_shadow_ranges;
+};
+
+/**
+ * Shader object that records writes so they can be replayed into other shader objects.
+ *
+ * The root shader object returned by \c ComputePassEncoder::bind_pipeline is transient and
+ * needs to be populated for every dispatch. A persistent shader object is populated once,
+ * typically through a \c ShaderCursor, and then applied to the root object of each dispatch.
+ * Between dispatches, only fields that changed need to be written again. Resources and
+ * samplers stay bound until they are overwritten or \c clear is called.
+ *
+ * Uniform data is kept in a host side copy and is replayed with one \c set_data call
+ * per contiguous range that was written. Entry points and sub-objects returned by
+ * \c get_entry_point and \c get_object are persistent shader objects themselves.
+ * Sub-objects (parameter blocks and constant buffers) are replayed into a shader object
+ * with the shadow copy enabled that is kept across replays and bound to each target,
+ * so only their uniform data that changed since the last replay is uploaded.
+ * CUDA tensor views are wrapped in an interop buffer once, which is bound to and
+ * registered with the target on every replay.
+ */
+class SGL_API PersistentShaderObject : public ShaderObject {
+    SGL_OBJECT(PersistentShaderObject)
+public:
+    /// Constructor.
+    /// \param layout_object Shader object used for reflection only. It is never written to.
+    PersistentShaderObject(ref<ShaderObject> layout_object);
+    ~PersistentShaderObject() override;
+
+    ref<ShaderObject> get_entry_point(uint32_t index) override;
+
+    ref<ShaderObject> get_object(const ShaderOffset& offset) override;
+    void set_object(const ShaderOffset& offset, const ref<ShaderObject>& object) override;
+
+    void set_buffer(const ShaderOffset& offset, const ref<Buffer>& buffer) override;
+    void set_buffer_view(const ShaderOffset& offset, const ref<BufferView>& buffer_view) override;
+    void set_texture(const ShaderOffset& offset, const ref<Texture>& texture) override;
+    void set_texture_view(const ShaderOffset& offset, const ref<TextureView>& texture_view) override;
+    void set_sampler(const ShaderOffset& offset, const ref<Sampler>& sampler) override;
+    void set_acceleration_structure(
+        const ShaderOffset& offset,
+        const ref<AccelerationStructure>& acceleration_structure
+    ) override;
+    void set_data(const ShaderOffset& offset, const void* data, size_t size) override;
+
+    void set_cuda_tensor_view(const ShaderOffset& offset, const cuda::TensorView& tensor_view, bool is_uav) override;
+    void get_cuda_interop_buffers(std::vector<ref<cuda::InteropBuffer>>& cuda_interop_buffers) const override;
+
+    /// Replay all recorded writes into the \c target shader object.
+    void apply(ShaderObject* target) const;
+
+    /// Remove all recorded writes, including those of entry points and sub-objects.
+    void clear();
+
+    /// Size of the recorded uniform data in bytes.
+    size_t uniform_data_size() const;
+
+private:
+    using Binding = std::variant<
+        ref<Buffer>,
+        ref<BufferView>,
+        ref<Texture>,
+        ref<TextureView>,
+        ref<Sampler>,
+        ref<AccelerationStructure>,
+        ref<ShaderObject>,
+        ref<cuda::InteropBuffer>>;
+
+    void set_binding(const ShaderOffset& offset, Binding binding);
+
+    /// Replay the recorded writes of a sub-object into \c m_materialized and return it.
+    const ref<ShaderObject>& materialize() const;
+
+    ref<ShaderObject> m_layout_object;
+    /// Host side copy of the uniform data.
+    std::vector<uint8_t> m_data;
+    /// Sorted, non-overlapping ranges [begin, end) of \c m_data that were written.
+    std::vector<std::pair<size_t, size_t>> m_data_ranges;
+    std::map<ShaderOffset, Binding> m_bindings;
+    std::map<uint32_t, ref<PersistentShaderObject>> m_entry_points;
+    std::map<ShaderOffset, ref<PersistentShaderObject>> m_sub_objects;
+    /// Shader object with shadow copy that sub-objects are replayed into (see \c materialize).
+    mutable ref<ShaderObject> m_materialized;
 };
 
 } // namespace sgl
@@ -0,0 +1,136 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "shader_struct.h"
+
+#include "sgl/device/cursor_utils.h"
+
+#include "sgl/core/error.h"
+#include "sgl/core/string.h"
+
+namespace sgl::detail {
+
+static void check_shader_struct_field(
+    const ShaderStructField& field,
+    const FlatTypeLayout::Field& slang_field,
+    std::string_view type_name
+)
+{
+    SGL_CHECK(
+        field.offset == slang_field.uniform_offset,
+        "Field \"{}\" of \"{}\" is at byte offset {} but the shader expects offset {}.",
+        field.name,
+        type_name,
+        field.offset,
+        slang_field.uniform_offset
+    );
+    SGL_CHECK(
+        field.size == slang_field.type_layout->getSize(),
+        "Field \"{}\" of \"{}\" has size {} but the shader expects size {}.",
+        field.name,
+        type_name,
+        field.size,
+        slang_field.type_layout->getSize()
+    );
+
+    const FlatTypeLayout* layout = slang_field.layout;
+    if (field.kind == TypeReflection::Kind::array) {
+        SGL_CHECK(
+            layout->kind == TypeReflection::Kind::array,
+            "Field \"{}\" of \"{}\" is an array but the shader expects a non-array type.",
+            field.name,
+            type_name
+        );
+        SGL_CHECK(
+            layout->element_count == field.element_count,
+            "Field \"{}\" of \"{}\" has {} elements but the shader expects {}.",
+            field.name,
+            type_name,
+            field.element_count,
+            layout->element_count
+        );
+        SGL_CHECK(
+            layout->element_stride == field.size / field.element_count,
+            "Field \"{}\" of \"{}\" has element stride {} but the shader expects stride {}.",
+            field.name,
+            type_name,
+            field.size / field.element_count,
+            layout->element_stride
+        );
+    } else {
+        SGL_CHECK(
+            layout->kind == layout->leaf_kind,
+            "Field \"{}\" of \"{}\" is not an array in the shader.",
+            field.name,
+            type_name
+        );
+    }
+
+    switch (field.element_kind) {
+    case TypeReflection::Kind::scalar:
+        cursor_utils::check_scalar(layout, field.size, field.scalar_type);
+        break;
+    case TypeReflection::Kind::vector:
+        cursor_utils::check_vector(layout, field.size, field.scalar_type, field.cols);
+        break;
+    case TypeReflection::Kind::matrix:
+        cursor_utils::check_matrix(layout, field.size, field.scalar_type, field.rows, field.cols);
+        break;
+    default:
+        SGL_THROW("Field \"{}\" of \"{}\" has an unsupported type.", field.name, type_name);
+    }
+}
+
+ShaderOffset resolve_shader_struct(
+    const ShaderCursor& cursor,
+    std::string_view path,
+    std::string_view type_name,
+    size_t size,
+    std::span<const ShaderStructField> fields
+)
+{
+    SGL_CHECK(cursor.is_valid(), "Invalid cursor");
+
+    ShaderCursor variable = cursor;
+    for (const std::string& name : string::split(path, "."))
+        variable = variable[name];
+    SGL_CHECK(
+        variable.shader_object() == cursor.shader_object() && !variable.is_reference(),
+        "\"{}\" is not stored as uniform data in the shader object of the cursor.",
+        path
+    );
+
+    const FlatTypeLayout* layout = variable._flat_layout();
+    SGL_CHECK(layout->kind == TypeReflection::Kind::struct_, "\"{}\" is not a struct.", path);
+    SGL_CHECK(
+        size <= layout->type_layout->getSize(),
+        "\"{}\" has size {} but the shader struct \"{}\" has size {}.",
+        type_name,
+        size,
+        path,
+        layout->type_layout->getSize()
+    );
+    SGL_CHECK(
+        fields.size() == layout->fields.size(),
+        "\"{}\" has {} fields but the shader struct \"{}\" has {}.",
+        type_name,
+        fields.size(),
+        path,
+        layout->fields.size()
+    );
+
+    for (const ShaderStructField& field : fields) {
+        const FlatTypeLayout::Field* slang_field = layout->find_field(field.name);
+        SGL_CHECK(
+            slang_field,
+            "Field \"{}\" of \"{}\" not found in shader struct \"{}\".",
+            field.name,
+            type_name,
+            path
+        );
+        check_shader_struct_field(field, *slang_field, type_name);
+    }
+
+    return variable.offset();
+}
+
+} // namespace sgl::detail
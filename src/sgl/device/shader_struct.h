@@ -0,0 +1,229 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "sgl/device/fwd.h"
+#include "sgl/device/cursor_utils.h"
+#include "sgl/device/reflection.h"
+#include "sgl/device/shader_cursor.h"
+#include "sgl/device/shader_object.h"
+#include "sgl/device/shader_offset.h"
+
+#include "sgl/core/macros.h"
+
+#include <array>
+#include <cstddef>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace sgl {
+
+/// Description of a single field of a C++ struct mirroring a slang struct.
+struct ShaderStructField {
+    /// Field name (must match the slang field name).
+    const char* name;
+    /// Byte offset of the field in the C++ struct.
+    size_t offset;
+    /// Size of the field in bytes.
+    size_t size;
+    /// Kind of the field (scalar, vector, matrix or array).
+    TypeReflection::Kind kind;
+    /// Kind of the array elements (scalar, vector or matrix). Same as \c kind for non-array fields.
+    TypeReflection::Kind element_kind;
+    /// Scalar type of the field.
+    TypeReflection::ScalarType scalar_type;
+    /// Number of rows (matrices) or 1.
+    int rows;
+    /// Number of columns (matrices), number of elements (vectors) or 1.
+    int cols;
+    /// Number of array elements, or 0 for non-array fields.
+    size_t element_count;
+};
+
+/**
+ * Describes the fields of a C++ struct that mirrors a slang struct.
+ *
+ * Specialized using the \c SGL_SHADER_STRUCT_BEGIN, \c SGL_SHADER_STRUCT_FIELD and
+ * \c SGL_SHADER_STRUCT_END macros, which need to be used at global namespace scope.
+ */
+template<typename T>
+struct ShaderStructTraits;
+
+namespace detail {
+
+    template<typename T>
+    constexpr ShaderStructField make_shader_struct_field(const char* name, size_t offset)
+    {
+        static_assert(
+            !std::is_same_v<T, bool>,
+            "bool fields are not supported, as host and device sizes differ (use uint32_t instead)"
+        );
+        using FieldType = CursorValueTraits<T>;
+        return ShaderStructField{
+            .name = name,
+            .offset = offset,
+            .size = sizeof(T),
+            .kind = FieldType::kind,
+            .element_kind = FieldType::kind,
+            .scalar_type = FieldType::scalar_type,
+            .rows = FieldType::rows,
+            .cols = FieldType::cols,
+            .element_count = 0,
+        };
+    }
+
+    template<typename T, size_t N>
+    struct ShaderStructArrayField {
+        static constexpr ShaderStructField make(const char* name, size_t offset)
+        {
+            ShaderStructField field = make_shader_struct_field<T>(name, offset);
+            field.size = sizeof(T) * N;
+            field.kind = TypeReflection::Kind::array;
+            field.element_count = N;
+            return field;
+        }
+    };
+
+    template<typename T>
+    struct ShaderStructFieldMaker {
+        static constexpr ShaderStructField make(const char* name, size_t offset)
+        {
+            return make_shader_struct_field<T>(name, offset);
+        }
+    };
+
+    template<typename T, size_t N>
+    struct ShaderStructFieldMaker<std::array<T, N>> : ShaderStructArrayField<T, N> { };
+
+    template<typename T, size_t N>
+    struct ShaderStructFieldMaker<T[N]> : ShaderStructArrayField<T, N> { };
+
+    /**
+     * Find a uniform struct variable and validate its layout against a C++ struct.
+     *
+     * \param cursor Cursor the path is relative to.
+     * \param path Path to the variable, with fields separated by '.'.
+     * \param type_name Name of the C++ struct (used for error messages).
+     * \param size Size of the C++ struct in bytes.
+     * \param fields Fields of the C++ struct.
+     * \return Offset of the variable in the shader object of \c cursor.
+     */
+    SGL_API ShaderOffset resolve_shader_struct(
+        const ShaderCursor& cursor,
+        std::string_view path,
+        std::string_view type_name,
+        size_t size,
+        std::span<const ShaderStructField> fields
+    );
+
+} // namespace detail
+
+/**
+ * Binds a C++ struct to a uniform struct variable of a shader.
+ *
+ * The fields of the C++ struct are described by \c ShaderStructTraits. The first time the
+ * binding is written through a cursor of a given program, the variable is looked up by path
+ * and its layout is validated against the C++ struct: every slang field needs a C++ field with
+ * the same name, byte offset, size and type. After that, writing the struct is a single
+ * \c set_data call at the cached offset, without any name lookups or per-field type checks.
+ *
+ * The variable needs to be stored as uniform data in the shader object of the cursor,
+ * e.g. a global or entry point parameter. Variables behind a constant buffer or parameter
+ * block are not supported, use a cursor to the dereferenced block instead.
+ *
+ * A binding caches the layout it last resolved, so it is not thread-safe. Use a separate
+ * binding per thread when writing from multiple threads.
+ *
+ * Example:
+ * \code
+ * struct Params {
+ *     uint2 resolution;
+ *     float exposure;
+ *     uint32_t frame;
+ * };
+ *
+ * SGL_SHADER_STRUCT_BEGIN(Params)
+ * SGL_SHADER_STRUCT_FIELD(resolution)
+ * SGL_SHADER_STRUCT_FIELD(exposure)
+ * SGL_SHADER_STRUCT_FIELD(frame)
+ * SGL_SHADER_STRUCT_END()
+ *
+ * ShaderStructBinding<Params> g_params("g_params");
+ * ...
+ * g_params.write(ShaderCursor(root_object), params);
+ * \endcode
+ */
+template<typename T>
+class ShaderStructBinding {
+    static_assert(std::is_trivially_copyable_v<T>, "Shader struct types must be trivially copyable");
+
+public:
+    /// Constructor.
+    /// \param path Path to the variable relative to the cursor passed to \c write.
+    explicit ShaderStructBinding(std::string path)
+        : m_path(std::move(path))
+    {
+    }
+
+    /// Path to the variable.
+    const std::string& path() const { return m_path; }
+
+    /// Look up and validate the variable relative to \c cursor, if not already done for its layout.
+    void resolve(const ShaderCursor& cursor)
+    {
+        // The flattened layout is kept alive by holding on to its cache, so the pointer
+        // cannot be reused by the layout of another (e.g. hot reloaded) program.
+        const FlatTypeLayout* parent_layout = cursor._flat_layout();
+        if (parent_layout == m_parent_layout && cursor.offset() == m_parent_offset)
+            return;
+        m_offset = detail::resolve_shader_struct(
+            cursor,
+            m_path,
+            ShaderStructTraits<T>::name,
+            sizeof(T),
+            ShaderStructTraits<T>::fields()
+        );
+        m_flat_layouts = cursor.shader_object()->_flat_layouts();
+        m_parent_layout = parent_layout;
+        m_parent_offset = cursor.offset();
+    }
+
+    /// Write the struct to the variable relative to \c cursor.
+    void write(const ShaderCursor& cursor, const T& value)
+    {
+        resolve(cursor);
+        cursor.shader_object()->set_data(m_offset, &value, sizeof(T));
+    }
+
+private:
+    std::string m_path;
+    ref<FlatTypeLayoutCache> m_flat_layouts;
+    const FlatTypeLayout* m_parent_layout{nullptr};
+    ShaderOffset m_parent_offset;
+    ShaderOffset m_offset;
+};
+
+} // namespace sgl
+
+/// Begin describing the fields of a C++ struct mirroring a slang struct.
+#define SGL_SHADER_STRUCT_BEGIN(type)                                                                                  \
+    template<>                                                                                                         \
+    struct sgl::ShaderStructTraits<type> {                                                                             \
+        using struct_type = type;                                                                                      \
+        static constexpr const char* name{#type};                                                                      \
+        static std::span<const ::sgl::ShaderStructField> fields()                                                      \
+        {                                                                                                              \
+            static const ::sgl::ShaderStructField s_fields[] = {
+
+/// Describe a field of a C++ struct mirroring a slang struct.
+#define SGL_SHADER_STRUCT_FIELD(name)                                                                                  \
+    ::sgl::detail::ShaderStructFieldMaker<decltype(struct_type::name)>::make(#name, offsetof(struct_type, name)),
+
+/// End describing the fields of a C++ struct mirroring a slang struct.
+#define SGL_SHADER_STRUCT_END()                                                                                        \
+    };                                                                                                                 \
+    return s_fields;                                                                                                   \
+    }                                                                                                                  \
+    };
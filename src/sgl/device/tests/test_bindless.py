@@ -0,0 +1,182 @@
+# SPDX-License-Identifier: Apache-2.0
+
+import pytest
+import sys
+import sgl
+import numpy as np
+from pathlib import Path
+
+sys.path.append(str(Path(__file__).parent))
+import sglhelpers as helpers
+
+
+@pytest.mark.parametrize("device_type", helpers.DEFAULT_DEVICE_TYPES)
+def test_bindless_table(device_type: sgl.DeviceType):
+    if device_type in [sgl.DeviceType.metal, sgl.DeviceType.cuda]:
+        pytest.skip("Bindless resource table is only tested on D3D12 and Vulkan")
+
+    device = sgl.Device(
+        type=device_type,
+        enable_bindless=True,
+        bindless_desc={"texture_capacity": 16, "buffer_capacity": 16},
+        compiler_options={"include_paths": [Path(__file__).parent]},
+    )
+    table = device.bindless_table
+    assert table is not None
+
+    count = 4
+    textures = []
+    buffers = []
+    for i in range(count):
+        textures.append(
+            device.create_texture(
+                format=sgl.Format.rgba32_float,
+                width=1,
+                height=1,
+                usage=sgl.TextureUsage.shader_resource,
+                data=np.full(4, i, dtype=np.float32),
+            )
+        )
+        buffers.append(
+            device.create_buffer(
+                size=4,
+                usage=sgl.BufferUsage.shader_resource,
+                data=np.array([i * 10], dtype=np.float32),
+            )
+        )
+    texture_indices = [table.add_texture(texture) for texture in textures]
+    buffer_indices = [table.add_buffer(buffer) for buffer in buffers]
+    assert texture_indices == list(range(count))
+    assert buffer_indices == list(range(count))
+    assert table.texture_count == count
+    assert table.buffer_count == count
+
+    program = device.load_program("test_bindless.slang", ["compute_main"])
+    kernel = device.create_compute_kernel(program)
+    result = device.create_buffer(
+        element_count=count,
+        struct_size=16,
+        usage=sgl.BufferUsage.unordered_access,
+    )
+
+    def run(materials: list[tuple[int, int]]):
+        material_buffer = device.create_buffer(
+            size=len(materials) * 8,
+            usage=sgl.BufferUsage.shader_resource,
+            data=np.array(materials, dtype=np.uint32),
+        )
+        kernel.dispatch(
+            thread_count=[len(materials), 1, 1],
+            vars={"materials": material_buffer, "result": result},
+        )
+        return result.to_numpy().view(np.float32).reshape(-1, 4)[: len(materials)]
+
+    values = run([(i, count - 1 - i) for i in range(count)])
+    for i in range(count):
+        assert np.all(values[i] == i + (count - 1 - i) * 10)
+
+    # Removed indices are reused by later additions.
+    table.remove_texture(1)
+    assert table.texture_count == count - 1
+    replacement = device.create_texture(
+        format=sgl.Format.rgba32_float,
+        width=1,
+        height=1,
+        usage=sgl.TextureUsage.shader_resource,
+        data=np.full(4, 100, dtype=np.float32),
+    )
+    assert table.add_texture(replacement) == 1
+
+    values = run([(1, 0)])
+    assert np.all(values[0] == 100)
+
+    with pytest.raises(Exception):
+        table.remove_buffer(count)
+
+
+@pytest.mark.parametrize("device_type", helpers.DEFAULT_DEVICE_TYPES)
+def test_bindless_table_update_after_record(device_type: sgl.DeviceType):
+    if device_type in [sgl.DeviceType.metal, sgl.DeviceType.cuda]:
+        pytest.skip("Bindless resource table is only tested on D3D12 and Vulkan")
+
+    device = sgl.Device(
+        type=device_type,
+        enable_bindless=True,
+        bindless_desc={"texture_capacity": 16, "buffer_capacity": 16},
+        compiler_options={"include_paths": [Path(__file__).parent]},
+    )
+    table = device.bindless_table
+
+    def create_texture(value: float):
+        return device.create_texture(
+            format=sgl.Format.rgba32_float,
+            width=1,
+            height=1,
+            usage=sgl.TextureUsage.shader_resource,
+            data=np.full(4, value, dtype=np.float32),
+        )
+
+    def create_buffer(value: float):
+        return device.create_buffer(
+            size=4,
+            usage=sgl.BufferUsage.shader_resource,
+            data=np.array([value], dtype=np.float32),
+        )
+
+    assert table.add_texture(create_texture(1)) == 0
+    assert table.add_texture(create_texture(2)) == 1
+    assert table.add_buffer(create_buffer(10)) == 0
+
+    program = device.load_program("test_bindless.slang", ["compute_main"])
+    kernel = device.create_compute_kernel(program)
+    materials = device.create_buffer(
+        size=16,
+        usage=sgl.BufferUsage.shader_resource,
+        data=np.array([(0, 0), (1, 0)], dtype=np.uint32),
+    )
+
+    def record(encoder: sgl.CommandEncoder):
+        result = device.create_buffer(
+            element_count=2,
+            struct_size=16,
+            usage=sgl.BufferUsage.unordered_access,
+        )
+        kernel.dispatch(
+            thread_count=[2, 1, 1],
+            vars={"materials": materials, "result": result},
+            command_encoder=encoder,
+        )
+        return result
+
+    def read(result: sgl.Buffer):
+        return result.to_numpy().view(np.float32).reshape(-1, 4)[:, 0].tolist()
+
+    # Replace texture 0 and remove texture 1 after recording, but before submitting.
+    encoder = device.create_command_encoder()
+    result = record(encoder)
+    table.remove_texture(0)
+    assert table.add_texture(create_texture(3)) == 0
+    table.remove_texture(1)
+    device.submit_command_buffer(encoder.finish())
+    assert read(result) == [11, 12]
+
+    # Work recorded after the update sees the new resources.
+    assert table.add_texture(create_texture(4)) == 1
+    encoder = device.create_command_encoder()
+    result = record(encoder)
+    device.submit_command_buffer(encoder.finish())
+    assert read(result) == [13, 14]
+
+    # Dispatches recorded into one command buffer each see the table as recorded.
+    encoder = device.create_command_encoder()
+    first = record(encoder)
+    table.remove_buffer(0)
+    assert table.add_buffer(create_buffer(20)) == 0
+    second = record(encoder)
+    device.submit_command_buffer(encoder.finish())
+    assert read(first) == [13, 14]
+    assert read(second) == [23, 24]
+
+
+if __name__ == "__main__":
+    pytest.main([__file__, "-v"])
@@ -214,5 +214,154 @@ def test_upload_buffer_overflow_fail(device_type: sgl.DeviceType):
         device.submit_command_buffer(encoder.finish())
 
 
+@pytest.mark.parametrize("device_type", helpers.DEFAULT_DEVICE_TYPES)
+def test_upload_buffer_batched(device_type: sgl.DeviceType):
+    device = sgl.Device(
+        type=device_type,
+        enable_debug_layers=True,
+        enable_upload_batching=True,
+        upload_batch_size=16 * 1024,
+    )
+
+    buffers = [
+        device.create_buffer(
+            size=4 * 1024,
+            usage=sgl.BufferUsage.unordered_access
+            | sgl.BufferUsage.copy_source
+            | sgl.BufferUsage.copy_destination,
+        )
+        for _ in range(3)
+    ]
+    datas = [
+        np.random.randint(0, 0xFFFFFFFF, size=1024, dtype=np.uint32) for _ in range(3)
+    ]
+
+    # Uploads are recorded but not submitted until flushed.
+    for buffer, data in zip(buffers, datas):
+        buffer.copy_from_numpy(data)
+    assert device.pending_upload_size == 3 * 4 * 1024
+
+    # Reading back flushes pending uploads.
+    for buffer, data in zip(buffers, datas):
+        assert np.all(buffer.to_numpy().view(np.uint32) == data)
+    assert device.pending_upload_size == 0
+
+    # Exceeding the batch size threshold flushes automatically.
+    for _ in range(4):
+        buffers[0].copy_from_numpy(datas[0])
+    assert device.pending_upload_size == 0
+
+    # Explicit flush.
+    buffers[1].copy_from_numpy(datas[2])
+    assert device.pending_upload_size > 0
+    device.flush_uploads()
+    assert device.pending_upload_size == 0
+    assert np.all(buffers[1].to_numpy().view(np.uint32) == datas[2])
+
+    # Creating a command encoder does not flush pending uploads.
+    buffers[0].copy_from_numpy(datas[1])
+    assert device.pending_upload_size > 0
+    encoder = device.create_command_encoder()
+    assert device.pending_upload_size > 0
+
+    # Uploads issued before a submit are visible to the submitted commands,
+    # exactly as with unbatched uploads.
+    encoder.copy_buffer(buffers[2], 0, buffers[0], 0, 4 * 1024)
+    buffers[0].copy_from_numpy(datas[0])
+    device.submit_command_buffer(encoder.finish())
+    assert device.pending_upload_size == 0
+    assert np.all(buffers[2].to_numpy().view(np.uint32) == datas[0])
+    assert np.all(buffers[0].to_numpy().view(np.uint32) == datas[0])
+
+    device.close()
+
+
+@pytest.mark.parametrize("device_type", helpers.DEFAULT_DEVICE_TYPES)
+def test_read_buffer_async(device_type: sgl.DeviceType):
+    device = helpers.get_device(device_type)
+
+    data = np.random.randint(0, 0xFFFFFFFF, size=1024, dtype=np.uint32)
+    buffer = device.create_buffer(
+        usage=sgl.BufferUsage.unordered_access | sgl.BufferUsage.copy_source,
+        data=data,
+    )
+
+    encoder = device.create_command_encoder()
+    readback = encoder.read_buffer_async(buffer, 256, 2048)
+    assert not readback.is_submitted
+    device.submit_command_buffer(encoder.finish())
+    assert readback.is_submitted
+    assert readback.submit_id > 0
+
+    readback.wait()
+    assert readback.is_ready
+    assert readback.size == 2048
+    assert np.all(readback.to_numpy().view(np.uint32) == data[64:576])
+
+
+@pytest.mark.parametrize("device_type", helpers.DEFAULT_DEVICE_TYPES)
+def test_read_texture_async(device_type: sgl.DeviceType):
+    device = helpers.get_device(device_type)
+
+    data = np.random.randint(0, 0xFFFFFFFF, size=(40, 30), dtype=np.uint32)
+    texture = device.create_texture(
+        format=sgl.Format.r32_uint,
+        width=30,
+        height=40,
+        usage=sgl.TextureUsage.shader_resource | sgl.TextureUsage.copy_source,
+        data=data,
+    )
+
+    encoder = device.create_command_encoder()
+    readback = encoder.read_texture_async(texture, 0, 0)
+    assert not readback.is_submitted
+    device.submit_command_buffer(encoder.finish())
+    assert readback.is_submitted
+
+    readback.wait()
+    assert readback.is_ready
+    layout = readback.layout
+    assert layout.row_count == 40
+    assert readback.size == layout.size_in_bytes
+
+    # Data is returned in the raw layout, with rows padded to the row pitch.
+    raw = readback.to_numpy()
+    for y in range(40):
+        row = raw[y * layout.row_pitch : y * layout.row_pitch + 30 * 4]
+        assert np.all(row.view(np.uint32) == data[y])
+
+
+@pytest.mark.parametrize("device_type", helpers.DEFAULT_DEVICE_TYPES)
+def test_persistent_map(device_type: sgl.DeviceType):
+    device = helpers.get_device(device_type)
+
+    upload = device.create_buffer(
+        size=4 * 1024,
+        memory_type=sgl.MemoryType.upload,
+        persistent_map=True,
+        usage=sgl.BufferUsage.copy_source,
+    )
+    read_back = device.create_buffer(
+        size=4 * 1024,
+        memory_type=sgl.MemoryType.read_back,
+        persistent_map=True,
+        usage=sgl.BufferUsage.copy_destination,
+    )
+    assert upload.is_persistently_mapped
+    assert read_back.is_persistently_mapped
+
+    # Stream data through the mapped buffers several times.
+    for i in range(3):
+        data = np.random.randint(0, 0xFFFFFFFF, size=1024, dtype=np.uint32)
+        upload.copy_from_numpy(data)
+
+        encoder = device.create_command_encoder()
+        encoder.copy_buffer(read_back, 0, upload, 0, 4 * 1024)
+        device.wait_for_submit(device.submit_command_buffer(encoder.finish()))
+
+        # Persistently mapped memory is host coherent, no flush or invalidate is needed.
+        assert np.all(read_back.to_numpy().view(np.uint32) == data)
+
+
 if __name__ == "__main__":
     pytest.main([__file__, "-v", "-s"])
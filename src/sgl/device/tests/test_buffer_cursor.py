@@ -427,5 +427,154 @@ def test_apply_changes(device_type: sgl.DeviceType, seed: int):
             check_match(test, element[name].read())
 
 
+@pytest.mark.parametrize("device_type", helpers.DEFAULT_DEVICE_TYPES)
+def test_apply_dirty_pages(device_type: sgl.DeviceType):
+
+    # Create the module and buffer layout
+    (kernel, buffer_layout) = make_copy_module(device_type, TESTS)
+
+    # Make a buffer spanning multiple pages
+    stride = buffer_layout.element_type_layout.stride
+    count = (1024 * 1024) // stride
+    data = np.random.randint(0, 256, size=stride * count, dtype=np.uint8)
+    buffer = kernel.device.create_buffer(
+        element_count=count,
+        struct_type=buffer_layout,
+        usage=sgl.BufferUsage.shader_resource | sgl.BufferUsage.unordered_access,
+        data=data,
+    )
+    cursor = sgl.BufferCursor(buffer_layout.element_type_layout, buffer)
+    assert cursor.dirty_size == 0
+
+    # Writing a single element only dirties the page(s) containing it
+    index = count // 2
+    cursor[index]["f_int32"] = 12345
+    assert 0 < cursor.dirty_size < cursor.size // 4
+
+    # Apply uploads the dirty page(s) only, without clobbering the rest
+    cursor.apply()
+    assert cursor.dirty_size == 0
+
+    check_cursor = sgl.BufferCursor(buffer_layout.element_type_layout, buffer)
+    assert check_cursor[index]["f_int32"].read() == 12345
+    result = buffer.to_numpy().view(np.uint8)
+    offset = cursor[index]["f_int32"]._offset
+    assert np.all(result[:offset] == data[:offset])
+    assert np.all(result[offset + 4 :] == data[offset + 4 :])
+
+
+@pytest.mark.parametrize("device_type", helpers.DEFAULT_DEVICE_TYPES)
+def test_field_accessor(device_type: sgl.DeviceType):
+
+    # Create the module and buffer layout
+    (kernel, buffer_layout) = make_copy_module(device_type, TESTS)
+
+    count = 100
+    cursor = sgl.BufferCursor(buffer_layout.element_type_layout, count)
+
+    # Resolved offsets match per element field lookups
+    f_int32 = sgl.BufferFieldAccessor(cursor, "f_int32")
+    f_float3_y = sgl.BufferFieldAccessor(cursor, "f_float3[1]")
+    assert f_int32.offset == cursor[0]["f_int32"]._offset
+    assert f_int32.size == 4
+    assert f_float3_y.offset == cursor[0]["f_float3"][1]._offset
+
+    # Bulk write a field of all elements and read it back per element
+    values = np.arange(count, dtype=np.int32) * 3
+    f_int32.set_range(0, values)
+    for i in range(count):
+        assert cursor[i]["f_int32"].read() == values[i]
+    assert np.all(f_int32.get_range(0, count).view(np.int32).flatten() == values)
+
+    # Single element access through the accessor
+    f_float3_y[5] = 2.5
+    assert cursor[5]["f_float3"].read().y == 2.5
+    assert f_float3_y[5].read() == 2.5
+    assert f_int32.get_range(10, 2).view(np.int32).flatten().tolist() == [30, 33]
+
+    # Invalid paths and ranges are rejected
+    with pytest.raises(RuntimeError):
+        sgl.BufferFieldAccessor(cursor, "f_missing")
+    with pytest.raises(RuntimeError):
+        sgl.BufferFieldAccessor(cursor, "f_float3[7]")
+    with pytest.raises(RuntimeError):
+        f_int32.set_range(count - 1, values[:2])
+
+    # Values of a different scalar type are converted, raw bytes from get_range are copied
+    f_int32.set_range(0, np.arange(count, dtype=np.float64))
+    result = f_int32.get_range(0, count).view(np.int32).flatten()
+    assert np.all(result == np.arange(count))
+    f_int32.set_range(50, f_int32.get_range(0, 50))
+    assert np.all(f_int32.get_range(50, 50).view(np.int32).flatten() == np.arange(50))
+
+    # Vector fields take one row of components per element
+    f_float3 = sgl.BufferFieldAccessor(cursor, "f_float3")
+    f_float3.set_range(0, np.full((count, 3), 1.5, dtype=np.float32))
+    assert list(cursor[7]["f_float3"].read()) == [1.5, 1.5, 1.5]
+
+    # Mismatching component counts and unsupported dtypes are rejected
+    with pytest.raises(RuntimeError):
+        f_float3.set_range(0, np.zeros(count * 3, dtype=np.float32))
+    with pytest.raises(RuntimeError):
+        f_int32.set_range(0, np.zeros((count, 2), dtype=np.int32))
+    with pytest.raises(RuntimeError):
+        f_int32.set_range(0, np.zeros(count, dtype=np.complex64))
+
+
+@pytest.mark.parametrize("device_type", helpers.DEFAULT_DEVICE_TYPES)
+def test_write_columns(device_type: sgl.DeviceType):
+
+    # Create the module and buffer layout
+    (kernel, buffer_layout) = make_copy_module(device_type, TESTS)
+
+    count = 1000
+    cursor = sgl.BufferCursor(buffer_layout.element_type_layout, count)
+
+    # Columns from a dict, with float64 values converted to the float32 fields
+    f_int32 = np.arange(count, dtype=np.int32) - 500
+    f_float3 = np.random.rand(count, 3)
+    cursor.write_columns({"f_int32": f_int32, "f_float3": f_float3})
+    for i in [0, 1, count // 2, count - 1]:
+        assert cursor[i]["f_int32"].read() == f_int32[i]
+        assert np.allclose(list(cursor[i]["f_float3"].read()), f_float3[i])
+
+    # Columns from a structured array, written to a sub range of the elements
+    data = np.zeros(10, dtype=[("f_uint32", np.uint16), ("f_float2", np.float32, 2)])
+    data["f_uint32"] = np.arange(10)
+    data["f_float2"] = np.random.rand(10, 2)
+    cursor.write_columns(data, first=20)
+    for i in range(10):
+        assert cursor[20 + i]["f_uint32"].read() == i
+        assert np.allclose(list(cursor[20 + i]["f_float2"].read()), data["f_float2"][i])
+    assert cursor[19]["f_int32"].read() == f_int32[19]
+
+    # Mismatching shapes and unknown fields are rejected
+    with pytest.raises(RuntimeError):
+        cursor.write_columns({"f_float3": np.zeros((count, 2))})
+    with pytest.raises(RuntimeError):
+        cursor.write_columns({"f_missing": np.zeros(count)})
+    with pytest.raises(RuntimeError):
+        cursor.write_columns({"f_int32": np.zeros(count + 1, dtype=np.int32)})
+
+    # Invalid columns are rejected before any column is written
+    for invalid in [
+        {"f_float3": np.zeros((count, 2))},
+        {"f_missing": np.zeros(count)},
+        {"f_float2": np.zeros((count, 2), dtype=np.complex64)},
+    ]:
+        with pytest.raises(RuntimeError):
+            cursor.write_columns(
+                {"f_int32": np.zeros(count, dtype=np.int32), **invalid}
+            )
+        assert cursor[0]["f_int32"].read() == f_int32[0]
+        assert cursor[count - 1]["f_int32"].read() == f_int32[count - 1]
+    with pytest.raises(RuntimeError):
+        cursor.write_columns(
+            {"f_int32": np.zeros(10, dtype=np.int32), "f_float2": np.zeros((10, 2))},
+            first=count - 5,
+        )
+    assert cursor[count - 5]["f_int32"].read() == f_int32[count - 5]
+
+
 if __name__ == "__main__":
     pytest.main([__file__, "-v", "-s"])
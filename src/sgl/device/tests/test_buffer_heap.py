@@ -0,0 +1,112 @@
+# SPDX-License-Identifier: Apache-2.0
+
+import pytest
+import numpy as np
+import sgl
+import sys
+from pathlib import Path
+
+sys.path.append(str(Path(__file__).parent))
+import sglhelpers as helpers
+
+
+@pytest.mark.parametrize("device_type", helpers.DEFAULT_DEVICE_TYPES)
+def test_buffer_heap_allocate(device_type: sgl.DeviceType):
+    device = helpers.get_device(device_type)
+
+    heap = device.create_buffer_heap(page_size=64 * 1024, min_block_size=256)
+
+    # Small allocations share a page and are aligned to their size class.
+    a = heap.allocate(100)
+    b = heap.allocate(200)
+    c = heap.allocate(1000)
+    assert a.size == 100
+    assert a.buffer == b.buffer
+    assert a.offset % 256 == 0
+    assert b.offset % 256 == 0
+    assert c.offset % 1024 == 0
+    assert a.offset != b.offset
+
+    stats = heap.stats
+    assert stats.allocation_count == 3
+    assert stats.requested_size == 1300
+    assert stats.allocated_size == 256 + 256 + 1024
+    # The first page of each size class holds 16 blocks.
+    assert stats.page_count == 2
+    assert stats.reserved_size == 16 * 256 + 16 * 1024
+    assert 0 < stats.fragmentation < 1
+
+    # Large allocations get a dedicated buffer.
+    d = heap.allocate(100 * 1024)
+    assert d.offset == 0
+    assert d.buffer.size >= 100 * 1024
+
+    # Data round trip.
+    data = np.random.randint(0, 0xFFFFFFFF, size=50, dtype=np.uint32)
+    b.copy_from_numpy(data)
+    assert np.all(b.to_numpy().view(np.uint32) == data)
+
+    del a, b, c, d
+    stats = heap.stats
+    assert stats.allocation_count == 0
+    assert stats.requested_size == 0
+    assert stats.allocated_size == 0
+
+
+@pytest.mark.parametrize("device_type", helpers.DEFAULT_DEVICE_TYPES)
+def test_buffer_heap_page_growth(device_type: sgl.DeviceType):
+    device = helpers.get_device(device_type)
+
+    heap = device.create_buffer_heap(page_size=16 * 1024, min_block_size=256)
+
+    # Pages of a size class double in size up to the page size.
+    allocations = [heap.allocate(256) for _ in range(16)]
+    assert heap.stats.page_count == 1
+    assert heap.stats.reserved_size == 4 * 1024
+    allocations += [heap.allocate(256) for _ in range(32 + 1)]
+    assert heap.stats.page_count == 3
+    assert heap.stats.reserved_size == (4 + 8 + 16) * 1024
+    allocations += [heap.allocate(256) for _ in range(63 + 1)]
+    assert heap.stats.page_count == 4
+    assert heap.stats.reserved_size == (4 + 8 + 16 + 16) * 1024
+
+
+@pytest.mark.parametrize("device_type", helpers.DEFAULT_DEVICE_TYPES)
+def test_buffer_heap_recycle(device_type: sgl.DeviceType):
+    device = helpers.get_device(device_type)
+
+    heap = device.create_buffer_heap(page_size=64 * 1024, min_block_size=256)
+
+    # Freed blocks are recycled immediately if no submission is pending.
+    device.wait_for_idle()
+    a = heap.allocate(256)
+    offset = a.offset
+    del a
+    b = heap.allocate(256)
+    assert b.offset == offset
+    del b
+
+    # Allocating and freeing without submitting does not grow the heap.
+    for _ in range(1000):
+        c = heap.allocate(1000)
+        del c
+    assert heap.stats.page_count == 2
+    assert heap.stats.pending_free_size == 0
+
+    # Freed blocks are recycled once the last submission has finished.
+    d = heap.allocate(256)
+    offset = d.offset
+    device.submit_command_buffer(device.create_command_encoder().finish())
+    del d
+    device.wait_for_idle()
+    e = heap.allocate(256)
+    assert e.offset == offset
+    del e
+
+    # Pages with no live allocations are released by trim.
+    heap.trim()
+    assert heap.stats.page_count == 0
+
+
+if __name__ == "__main__":
+    pytest.main([__file__, "-v"])
@@ -20,4 +20,11 @@ TEST_CASE_GPU("init")
     CHECK(ctx.device);
 }
 
+TEST_CASE_GPU("get_native_command_queue_handle")
+{
+    // Compute and transfer queues are emulated and have no native handle.
+    CHECK_THROWS(ctx.device->get_native_command_queue_handle(CommandQueueType::compute));
+    CHECK_THROWS(ctx.device->get_native_command_queue_handle(CommandQueueType::transfer));
+}
+
 TEST_SUITE_END();
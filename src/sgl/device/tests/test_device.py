@@ -133,5 +133,252 @@ def test_hot_reload_event(device_type: sgl.DeviceType):
     assert count == 1
 
 
+@pytest.mark.parametrize("device_type", helpers.DEFAULT_DEVICE_TYPES)
+def test_memory_tracker(device_type: sgl.DeviceType):
+    device = sgl.Device(type=device_type, enable_debug_layers=True)
+    tracker = device.memory_tracker
+
+    base_usage = tracker.device_usage
+    base_buffers = tracker.stats(sgl.MemoryCategory.buffer)
+
+    events = []
+    tracker.register_budget_callback(lambda event: events.append(event))
+    tracker.set_budget(base_usage + 2 * 1024 * 1024, [0.5, 1.0])
+
+    buffer = device.create_buffer(
+        size=1024 * 1024, usage=sgl.BufferUsage.unordered_access, label="tracked"
+    )
+    stats = tracker.stats(sgl.MemoryCategory.buffer)
+    assert stats.current == base_buffers.current + 1024 * 1024
+    assert stats.count == base_buffers.count + 1
+    assert tracker.device_usage == base_usage + 1024 * 1024
+    assert tracker.usage_by_label()["tracked"] == 1024 * 1024
+
+    staging = device.create_buffer(
+        size=2 * 1024 * 1024,
+        usage=sgl.BufferUsage.copy_destination,
+        memory_type=sgl.MemoryType.read_back,
+    )
+    assert tracker.stats(sgl.MemoryCategory.staging).current >= 2 * 1024 * 1024
+    assert len(events) >= 1
+    assert events[-1].exceeded
+
+    # Memory is untracked once the allocations are actually released.
+    del buffer, staging
+    device.wait_for_idle()
+    assert tracker.device_usage == base_usage
+    assert tracker.peak_device_usage >= base_usage + 3 * 1024 * 1024
+    assert "tracked" not in tracker.usage_by_label()
+    assert "" not in tracker.usage_by_label()
+    assert not events[-1].exceeded
+
+    device.close()
+
+
+@pytest.mark.parametrize("device_type", helpers.DEFAULT_DEVICE_TYPES)
+def test_deferred_release(device_type: sgl.DeviceType):
+    device = sgl.Device(type=device_type, enable_debug_layers=True)
+
+    # Block the queue on a fence signaled from the host, so all following submissions stay pending.
+    fence = device.create_fence(initial_value=0)
+    device.submit_command_buffers(
+        [device.create_command_encoder().finish()],
+        wait_fences=[fence],
+        wait_fence_values=[1],
+    )
+
+    # Drop resources while they are still referenced by a pending submission.
+    for _ in range(4):
+        buffer = device.create_buffer(
+            size=1024 * 1024, usage=sgl.BufferUsage.unordered_access
+        )
+        texture = device.create_texture(
+            format=sgl.Format.rgba32_float,
+            width=256,
+            height=256,
+            usage=sgl.TextureUsage.unordered_access,
+        )
+        encoder = device.create_command_encoder()
+        encoder.clear_buffer(buffer)
+        encoder.clear_texture_float(texture, clear_value=sgl.float4(1, 0, 0, 1))
+        device.submit_command_buffer(encoder.finish())
+        del buffer, texture, encoder
+
+    assert device.deferred_release_count > 0
+
+    # Waiting for the device releases all pending objects.
+    fence.signal(1)
+    device.wait_for_idle()
+    assert device.deferred_release_count == 0
+    assert device.collect_deferred_releases() == 0
+
+    device.close()
+
+
+@pytest.mark.parametrize("device_type", helpers.DEFAULT_DEVICE_TYPES)
+def test_deferred_release_bound(device_type: sgl.DeviceType):
+    device = sgl.Device(type=device_type, enable_debug_layers=True)
+
+    # Block the queue on a fence signaled from the host.
+    fence = device.create_fence(initial_value=0)
+    submit_id = device.submit_command_buffers(
+        [device.create_command_encoder().finish()],
+        wait_fences=[fence],
+        wait_fence_values=[1],
+    )
+
+    # Resources destroyed while any submission is pending are deferred,
+    # even if they were never used on the GPU.
+    count = 16
+    for _ in range(count):
+        buffer = device.create_buffer(size=1024, usage=sgl.BufferUsage.shader_resource)
+        del buffer
+    assert device.deferred_release_count == count
+
+    # They are released as soon as the pending submission has finished,
+    # without waiting for the device to become idle.
+    fence.signal(1)
+    device.wait_for_submit(submit_id)
+    assert device.collect_deferred_releases() == count
+    assert device.deferred_release_count == 0
+
+    # Without pending submissions, resources are released immediately.
+    for _ in range(count):
+        buffer = device.create_buffer(size=1024, usage=sgl.BufferUsage.shader_resource)
+        del buffer
+    assert device.deferred_release_count == 0
+
+    device.close()
+
+
+@pytest.mark.parametrize("device_type", helpers.DEFAULT_DEVICE_TYPES)
+def test_multi_queue(device_type: sgl.DeviceType):
+    device = sgl.Device(type=device_type, enable_debug_layers=True)
+
+    data = np.random.randint(0, 0xFFFFFFFF, size=1024, dtype=np.uint32)
+    src = device.create_buffer(
+        usage=sgl.BufferUsage.copy_source | sgl.BufferUsage.copy_destination,
+        data=data,
+    )
+    dst = device.create_buffer(
+        size=4 * 1024,
+        usage=sgl.BufferUsage.unordered_access
+        | sgl.BufferUsage.copy_source
+        | sgl.BufferUsage.copy_destination,
+    )
+
+    # Clear on the compute queue.
+    encoder = device.create_command_encoder(sgl.CommandQueueType.compute)
+    encoder.clear_buffer(dst)
+    compute_id = device.submit_command_buffer(
+        encoder.finish(), sgl.CommandQueueType.compute
+    )
+
+    # Copy on the transfer queue after the clear has finished.
+    device.queue_wait_for_submit(sgl.CommandQueueType.transfer, compute_id)
+    encoder = device.create_command_encoder(sgl.CommandQueueType.transfer)
+    encoder.copy_buffer(dst, 0, src, 0, 4 * 1024)
+    transfer_id = device.submit_command_buffer(
+        encoder.finish(), sgl.CommandQueueType.transfer
+    )
+    assert transfer_id > compute_id
+
+    # Read back on the graphics queue.
+    device.queue_wait_for_submit(sgl.CommandQueueType.graphics, transfer_id)
+    assert np.all(dst.to_numpy().view(np.uint32) == data)
+
+    # Command buffers must be submitted to the queue they were recorded for.
+    encoder = device.create_command_encoder(sgl.CommandQueueType.transfer)
+    with pytest.raises(Exception):
+        device.submit_command_buffer(encoder.finish(), sgl.CommandQueueType.graphics)
+
+    device.wait_for_idle(sgl.CommandQueueType.transfer)
+    device.close()
+
+
+@pytest.mark.parametrize("device_type", helpers.DEFAULT_DEVICE_TYPES)
+def test_submit_parallel(device_type: sgl.DeviceType):
+    device = helpers.get_device(device_type)
+
+    count = 8
+    data = [
+        np.random.randint(0, 0xFFFFFFFF, size=256, dtype=np.uint32) for _ in range(count)
+    ]
+    src = [
+        device.create_buffer(usage=sgl.BufferUsage.copy_source, data=d) for d in data
+    ]
+    dst = device.create_buffer(
+        size=count * 1024,
+        usage=sgl.BufferUsage.unordered_access
+        | sgl.BufferUsage.copy_source
+        | sgl.BufferUsage.copy_destination,
+    )
+
+    def make_callback(i: int):
+        def record(encoder: sgl.CommandEncoder):
+            encoder.copy_buffer(dst, i * 1024, src[i], 0, 1024)
+
+        return record
+
+    command_buffers = device.record_parallel([make_callback(i) for i in range(count)])
+    assert len(command_buffers) == count
+
+    device.submit_parallel([make_callback(i) for i in range(count)])
+    assert np.all(dst.to_numpy().view(np.uint32) == np.concatenate(data))
+
+    def fail(encoder: sgl.CommandEncoder):
+        raise RuntimeError("recording failed")
+
+    with pytest.raises(RuntimeError):
+        device.submit_parallel([make_callback(0), fail])
+
+
+@pytest.mark.parametrize("device_type", helpers.DEFAULT_DEVICE_TYPES)
+def test_submit_parallel_blit(device_type: sgl.DeviceType):
+    # Use a fresh device, so the blit programs are compiled on the worker threads.
+    device = helpers.get_device(device_type, use_cache=False)
+
+    count = 8
+    formats = [sgl.Format.rgba32_float, sgl.Format.rgba8_unorm]
+    data = [
+        np.full((16, 16, 4), (i + 1) / count, dtype=np.float32) for i in range(count)
+    ]
+    src = [
+        device.create_texture(
+            format=sgl.Format.rgba32_float,
+            width=16,
+            height=16,
+            usage=sgl.TextureUsage.shader_resource,
+            data=d,
+        )
+        for d in data
+    ]
+    dst = [
+        device.create_texture(
+            format=formats[i % len(formats)],
+            width=16,
+            height=16,
+            usage=sgl.TextureUsage.render_target | sgl.TextureUsage.copy_source,
+        )
+        for i in range(count)
+    ]
+
+    def make_callback(i: int):
+        def record(encoder: sgl.CommandEncoder):
+            encoder.blit(dst[i], src[i], filter=sgl.TextureFilteringMode.point)
+
+        return record
+
+    device.submit_parallel([make_callback(i) for i in range(count)])
+    device.wait_for_idle()
+    for i in range(count):
+        result = dst[i].to_numpy()
+        if result.dtype == np.uint8:
+            result = result.astype(np.float32) / 255
+        assert np.allclose(result, data[i], atol=1 / 255)
+
+    device.close()
+
+
 if __name__ == "__main__":
     pytest.main([__file__, "-v"])
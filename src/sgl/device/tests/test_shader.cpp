@@ -3,8 +3,12 @@
 #include "testing.h"
 #include "sgl/device/device.h"
 #include "sgl/device/shader.h"
+#include "sgl/device/reflection.h"
+#include <atomic>
 #include <fstream>
 #include <filesystem>
+#include <string>
+#include <thread>
 
 using namespace sgl;
 
@@ -102,4 +106,75 @@ TEST_CASE_GPU("shader")
     }
 }
 
+static const char* REFLECTION_CACHE_SOURCE = R"SHADER(
+struct Foo {
+    uint a;
+    float2 b;
+};
+
+uniform Foo g_foo;
+uniform float4 g_color;
+RWStructuredBuffer<uint> g_result;
+
+[shader("compute")]
+[numthreads(1, 1, 1)]
+void main(uint3 tid : SV_DispatchThreadID)
+{
+    g_result[0] = g_foo.a + uint(g_foo.b.x + g_color.x);
+}
+)SHADER";
+
+TEST_CASE_GPU("reflection_cache_multithreaded")
+{
+    ref<SlangModule> module = ctx.device->load_module_from_source("test_reflection_cache", REFLECTION_CACHE_SOURCE);
+    ref<ShaderProgram> program = ctx.device->link_program({module}, {module->entry_point("main")});
+
+    // Wrappers held by this thread must be returned by every lookup.
+    ref<const ProgramLayout> held_layout = program->layout();
+    ref<const VariableLayoutReflection> held_parameter = held_layout->get_parameter_by_index(0);
+    std::vector<std::string> parameter_names;
+    for (uint32_t i = 0; i < held_layout->parameter_count(); ++i)
+        parameter_names.push_back(held_layout->get_parameter_by_index(i)->name());
+
+    // Threads look up the same wrappers and drop them again, so wrappers are destroyed
+    // on one thread while being looked up on another.
+    static constexpr uint32_t THREAD_COUNT = 8;
+    static constexpr uint32_t ITERATION_COUNT = 1000;
+    std::atomic<uint32_t> error_count{0};
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < THREAD_COUNT; ++t) {
+        threads.emplace_back(
+            [&]()
+            {
+                for (uint32_t iteration = 0; iteration < ITERATION_COUNT; ++iteration) {
+                    ref<const ProgramLayout> layout = program->layout();
+                    if (layout != held_layout)
+                        error_count++;
+                    if (layout->get_parameter_by_index(0) != held_parameter)
+                        error_count++;
+                    for (uint32_t i = 0; i < layout->parameter_count(); ++i) {
+                        ref<const VariableLayoutReflection> parameter = layout->get_parameter_by_index(i);
+                        if (parameter_names[i] != parameter->name())
+                            error_count++;
+                        ref<const TypeLayoutReflection> type_layout = parameter->type_layout();
+                        if (!type_layout || !type_layout->type())
+                            error_count++;
+                    }
+                    ref<const TypeLayoutReflection> globals = layout->globals_type_layout();
+                    if (!globals)
+                        error_count++;
+                }
+            }
+        );
+    }
+    for (std::thread& thread : threads)
+        thread.join();
+
+    CHECK_EQ(error_count.load(), 0);
+
+    // Dropped wrappers are recreated on the next lookup.
+    held_parameter = nullptr;
+    CHECK_EQ(std::string(held_layout->get_parameter_by_index(0)->name()), parameter_names[0]);
+}
+
 TEST_SUITE_END();
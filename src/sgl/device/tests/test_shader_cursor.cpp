@@ -0,0 +1,111 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "testing.h"
+#include "sgl/device/device.h"
+#include "sgl/device/shader.h"
+#include "sgl/device/kernel.h"
+#include "sgl/device/resource.h"
+#include "sgl/device/shader_cursor.h"
+#include "sgl/device/shader_object.h"
+
+#include <array>
+
+using namespace sgl;
+
+static const char* SHADER_CURSOR_SOURCE = R"SHADER(
+uniform float3x3 transform;
+uniform float2 position;
+uniform uint count;
+RWStructuredBuffer<float> result;
+
+[shader("compute")]
+[numthreads(1, 1, 1)]
+void main(uint3 tid : SV_DispatchThreadID)
+{
+    for (uint i = 0; i < 3; ++i)
+        for (uint j = 0; j < 3; ++j)
+            result[i * 3 + j] = transform[i][j];
+    result[9] = position.x;
+    result[10] = position.y;
+    result[11] = count;
+}
+)SHADER";
+
+TEST_SUITE_BEGIN("device");
+
+TEST_CASE_GPU("shader_cursor")
+{
+    ref<SlangModule> module = ctx.device->load_module_from_source("test_shader_cursor", SHADER_CURSOR_SOURCE);
+    ref<ShaderProgram> program = ctx.device->link_program({module}, {module->entry_point("main")});
+    ref<ShaderObject> root_object = ctx.device->create_root_shader_object(program);
+
+    SUBCASE("cached type checks")
+    {
+        ShaderCursor cursor(root_object);
+
+        // Repeated writes of the same type pass, other types are still rejected.
+        CHECK_NOTHROW(cursor["position"] = float2(1.f, 2.f));
+        CHECK_NOTHROW(cursor["position"] = float2(3.f, 4.f));
+        CHECK_THROWS(cursor["position"] = float3(1.f, 2.f, 3.f));
+        CHECK_THROWS(cursor["position"] = int2(1, 2));
+        CHECK_NOTHROW(cursor["position"] = float2(5.f, 6.f));
+
+        CHECK_NOTHROW(cursor["count"] = uint32_t(1));
+        CHECK_THROWS(cursor["count"] = 1.f);
+        CHECK_NOTHROW(cursor["count"] = uint32_t(2));
+    }
+
+    SUBCASE("set_unchecked")
+    {
+        ShaderCursor transform = ShaderCursor(root_object)["transform"];
+        uint32_t offset = transform.offset().uniform_offset;
+
+        // Matrix rows are padded to 16 bytes.
+        ref<PersistentShaderObject> checked = make_ref<PersistentShaderObject>(root_object);
+        ShaderCursor(checked)["transform"] = float3x3::identity();
+        ref<PersistentShaderObject> unchecked = make_ref<PersistentShaderObject>(root_object);
+        ShaderCursor(unchecked)["transform"].set_unchecked(float3x3::identity());
+        CHECK_EQ(unchecked->uniform_data_size(), offset + 2 * 16 + 3 * sizeof(float));
+        CHECK_EQ(unchecked->uniform_data_size(), checked->uniform_data_size());
+
+        // Unchecked writes must produce the same data as checked writes.
+        float3x3 transform_value = float3x3({1, 2, 3, 4, 5, 6, 7, 8, 9});
+        float2 position_value{10.f, 11.f};
+        uint32_t count_value = 12;
+
+        ref<ComputeKernel> kernel = ctx.device->create_compute_kernel({.program = program});
+        auto run = [&](bool use_unchecked)
+        {
+            ref<Buffer> buffer = ctx.device->create_buffer({
+                .element_count = 12,
+                .struct_size = 4,
+                .usage = BufferUsage::shader_resource | BufferUsage::unordered_access,
+            });
+            kernel->dispatch(
+                uint3(1, 1, 1),
+                [&](ShaderCursor kernel_cursor)
+                {
+                    if (use_unchecked) {
+                        kernel_cursor["transform"].set_unchecked(transform_value);
+                        kernel_cursor["position"].set_unchecked(position_value);
+                        kernel_cursor["count"].set_unchecked(count_value);
+                    } else {
+                        kernel_cursor["transform"] = transform_value;
+                        kernel_cursor["position"] = position_value;
+                        kernel_cursor["count"] = count_value;
+                    }
+                    kernel_cursor["result"] = buffer;
+                }
+            );
+            std::array<float, 12> result{};
+            buffer->get_data(result.data(), sizeof(result));
+            return result;
+        };
+
+        std::array<float, 12> expected{1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f, 9.f, 10.f, 11.f, 12.f};
+        CHECK_EQ(run(false), expected);
+        CHECK_EQ(run(true), expected);
+    }
+}
+
+TEST_SUITE_END();
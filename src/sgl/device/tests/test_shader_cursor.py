@@ -362,5 +362,221 @@ def test_shader_cursor(device_type: sgl.DeviceType, use_numpy: bool):
         assert named_result == named_reference
 
 
+PERSISTENT_ROOT_OBJECT_SHADER = r"""
+uniform float scale;
+uniform float offset;
+StructuredBuffer<float> src;
+RWStructuredBuffer<float> dst;
+
+[shader("compute")]
+[numthreads(16, 1, 1)]
+void compute_main(uint tid: SV_DispatchThreadID, uniform uint count)
+{
+    if (tid < count)
+        dst[tid] = src[tid] * scale + offset;
+}
+"""
+
+
+@pytest.mark.parametrize("device_type", helpers.DEFAULT_DEVICE_TYPES)
+def test_persistent_root_object(device_type: sgl.DeviceType):
+    device = helpers.get_device(type=device_type)
+    module = device.load_module_from_source(
+        "test_persistent_root_object", PERSISTENT_ROOT_OBJECT_SHADER
+    )
+    program = device.link_program([module], [module.entry_point("compute_main")])
+    kernel = device.create_compute_kernel(program)
+
+    count = 64
+    data = np.arange(count, dtype=np.float32)
+    src = device.create_buffer(
+        element_count=count,
+        struct_size=4,
+        usage=sgl.BufferUsage.shader_resource,
+        data=data,
+    )
+    dst = device.create_buffer(
+        element_count=count,
+        struct_size=4,
+        usage=sgl.BufferUsage.unordered_access,
+    )
+
+    # Populate the persistent root object once.
+    root_object = kernel.create_root_object()
+    cursor = sgl.ShaderCursor(root_object)
+    cursor["scale"] = 2.0
+    cursor["offset"] = 1.0
+    cursor["src"] = src
+    cursor["dst"] = dst
+    cursor.find_entry_point(0)["count"] = count
+    assert root_object.uniform_data_size >= 8
+
+    kernel.dispatch([count, 1, 1], root_object)
+    assert np.allclose(dst.to_numpy().view(np.float32), data * 2.0 + 1.0)
+
+    # Only patch the changed field, all other bindings are kept.
+    cursor["offset"] = -3.0
+    kernel.dispatch([count, 1, 1], root_object)
+    assert np.allclose(dst.to_numpy().view(np.float32), data * 2.0 - 3.0)
+
+    # Dispatch multiple times within a single command encoder.
+    command_encoder = device.create_command_encoder()
+    kernel.dispatch([count, 1, 1], root_object, command_encoder)
+    cursor["scale"] = 0.5
+    kernel.dispatch([count, 1, 1], root_object, command_encoder)
+    device.submit_command_buffer(command_encoder.finish())
+    assert np.allclose(dst.to_numpy().view(np.float32), data * 0.5 - 3.0)
+
+
+@pytest.mark.parametrize("device_type", helpers.DEFAULT_DEVICE_TYPES)
+def test_shadow_copy(device_type: sgl.DeviceType):
+    device = helpers.get_device(type=device_type)
+    module = device.load_module_from_source(
+        "test_shadow_copy", PERSISTENT_ROOT_OBJECT_SHADER
+    )
+    program = device.link_program([module], [module.entry_point("compute_main")])
+
+    root_object = device.create_root_shader_object(program)
+    assert not root_object.shadow_copy_enabled
+    root_object.shadow_copy_enabled = True
+    cursor = sgl.ShaderCursor(root_object)
+
+    # First writes are always uploaded.
+    cursor["scale"] = 2.0
+    cursor["offset"] = 1.0
+    stats = root_object.stats
+    assert stats.write_count == 2
+    assert stats.write_size == 8
+    assert stats.skipped_write_count == 0
+    assert stats.skipped_size == 0
+
+    # Writing the same values again is skipped.
+    cursor["scale"] = 2.0
+    cursor["offset"] = 1.0
+    stats = root_object.stats
+    assert stats.write_count == 4
+    assert stats.skipped_write_count == 2
+    assert stats.skipped_size == 8
+
+    # Changed values are uploaded.
+    cursor["offset"] = -3.0
+    stats = root_object.stats
+    assert stats.write_count == 5
+    assert stats.skipped_write_count == 2
+
+    root_object.reset_stats()
+    assert root_object.stats.write_count == 0
+
+    # Without the shadow copy, all writes are uploaded.
+    root_object.shadow_copy_enabled = False
+    cursor["scale"] = 2.0
+    assert root_object.stats.write_count == 1
+    assert root_object.stats.skipped_write_count == 0
+
+
+SHADOW_COPY_DISPATCH_SHADER = r"""
+struct Params {
+    float4x4 matrix;
+};
+ParameterBlock<Params> params;
+RWStructuredBuffer<float> dst;
+
+[shader("compute")]
+[numthreads(16, 1, 1)]
+void compute_main(uint tid: SV_DispatchThreadID)
+{
+    if (tid < 16)
+        dst[tid] = params.matrix[tid / 4][tid % 4];
+}
+"""
+
+
+def create_shadow_copy_dispatch_kernel(device: sgl.Device):
+    module = device.load_module_from_source(
+        "test_shadow_copy_dispatch", SHADOW_COPY_DISPATCH_SHADER
+    )
+    program = device.link_program([module], [module.entry_point("compute_main")])
+    params_layout = module.layout.get_type_layout(
+        module.layout.find_type_by_name("Params")
+    )
+    dst = device.create_buffer(
+        element_count=16,
+        struct_size=4,
+        usage=sgl.BufferUsage.unordered_access,
+    )
+    return device.create_compute_kernel(program), params_layout, dst
+
+
+@pytest.mark.parametrize("device_type", helpers.DEFAULT_DEVICE_TYPES)
+def test_shadow_copy_dispatch(device_type: sgl.DeviceType):
+    device = helpers.get_device(type=device_type)
+    kernel, params_layout, dst = create_shadow_copy_dispatch_kernel(device)
+
+    # Parameter block object kept around by the caller and bound to every dispatch.
+    params = device.create_shader_object(params_layout)
+    params.shadow_copy_enabled = True
+    cursor = sgl.ShaderCursor(params)
+
+    values = np.arange(16, dtype=np.float32)
+    cursor["matrix"] = sgl.float4x4(values.tolist())
+    kernel.dispatch([16, 1, 1], vars={"params": params, "dst": dst})
+    assert np.all(dst.to_numpy().view(np.float32) == values)
+
+    # Change two elements far apart (all bytes of the new values differ). Only the two
+    # changed runs are uploaded, the unchanged bytes at both ends and in the middle are skipped.
+    values[1] = 0.1
+    values[14] = -0.3
+    params.reset_stats()
+    cursor["matrix"] = sgl.float4x4(values.tolist())
+    assert params.stats.write_count == 1
+    assert params.stats.skipped_write_count == 0
+    assert params.stats.skipped_size == 64 - 2 * 4
+    kernel.dispatch([16, 1, 1], vars={"params": params, "dst": dst})
+    assert np.all(dst.to_numpy().view(np.float32) == values)
+
+    # Changes closer than the minimum gap are uploaded as a single run.
+    values[4] = 0.7
+    values[6] = 0.9
+    params.reset_stats()
+    cursor["matrix"] = sgl.float4x4(values.tolist())
+    assert params.stats.skipped_size == 64 - 3 * 4
+    kernel.dispatch([16, 1, 1], vars={"params": params, "dst": dst})
+    assert np.all(dst.to_numpy().view(np.float32) == values)
+
+    # Unchanged writes are skipped and the data stays bound.
+    params.reset_stats()
+    cursor["matrix"] = sgl.float4x4(values.tolist())
+    assert params.stats.skipped_write_count == 1
+    kernel.dispatch([16, 1, 1], vars={"params": params, "dst": dst})
+    assert np.all(dst.to_numpy().view(np.float32) == values)
+
+
+@pytest.mark.parametrize("device_type", helpers.DEFAULT_DEVICE_TYPES)
+def test_persistent_root_object_parameter_block(device_type: sgl.DeviceType):
+    device = helpers.get_device(type=device_type)
+    kernel, _, dst = create_shadow_copy_dispatch_kernel(device)
+
+    # Parameter blocks of a persistent root object are replayed into a shader object
+    # with shadow copy, so only changed data is uploaded between dispatches.
+    root_object = kernel.create_root_object()
+    cursor = sgl.ShaderCursor(root_object)
+    cursor["dst"] = dst
+
+    values = np.arange(16, dtype=np.float32)
+    cursor["params"]["matrix"] = sgl.float4x4(values.tolist())
+    kernel.dispatch([16, 1, 1], root_object)
+    assert np.all(dst.to_numpy().view(np.float32) == values)
+
+    values[2] = 100.0
+    values[13] = 200.0
+    cursor["params"]["matrix"] = sgl.float4x4(values.tolist())
+    kernel.dispatch([16, 1, 1], root_object)
+    assert np.all(dst.to_numpy().view(np.float32) == values)
+
+    # Dispatches without changes keep the data.
+    kernel.dispatch([16, 1, 1], root_object)
+    assert np.all(dst.to_numpy().view(np.float32) == values)
+
+
 if __name__ == "__main__":
     pytest.main([__file__, "-vvvs"])
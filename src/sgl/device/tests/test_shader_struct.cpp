@@ -0,0 +1,178 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "testing.h"
+#include "sgl/device/device.h"
+#include "sgl/device/shader.h"
+#include "sgl/device/kernel.h"
+#include "sgl/device/resource.h"
+#include "sgl/device/shader_object.h"
+#include "sgl/device/shader_struct.h"
+
+using namespace sgl;
+
+struct TestParams {
+    uint2 resolution;
+    float exposure;
+    uint32_t frame;
+    float4x4 transform;
+    float4 weights;
+};
+
+struct TestParamsMissingField {
+    uint2 resolution;
+    float exposure;
+};
+
+struct TestParamsWrongType {
+    uint2 resolution;
+    uint32_t exposure;
+    uint32_t frame;
+    float4x4 transform;
+    float4 weights;
+};
+
+SGL_SHADER_STRUCT_BEGIN(TestParams)
+SGL_SHADER_STRUCT_FIELD(resolution)
+SGL_SHADER_STRUCT_FIELD(exposure)
+SGL_SHADER_STRUCT_FIELD(frame)
+SGL_SHADER_STRUCT_FIELD(transform)
+SGL_SHADER_STRUCT_FIELD(weights)
+SGL_SHADER_STRUCT_END()
+
+SGL_SHADER_STRUCT_BEGIN(TestParamsMissingField)
+SGL_SHADER_STRUCT_FIELD(resolution)
+SGL_SHADER_STRUCT_FIELD(exposure)
+SGL_SHADER_STRUCT_END()
+
+SGL_SHADER_STRUCT_BEGIN(TestParamsWrongType)
+SGL_SHADER_STRUCT_FIELD(resolution)
+SGL_SHADER_STRUCT_FIELD(exposure)
+SGL_SHADER_STRUCT_FIELD(frame)
+SGL_SHADER_STRUCT_FIELD(transform)
+SGL_SHADER_STRUCT_FIELD(weights)
+SGL_SHADER_STRUCT_END()
+
+static const char* SHADER_STRUCT_SOURCE = R"SHADER(
+struct Params {
+    uint2 resolution;
+    float exposure;
+    uint frame;
+    float4x4 transform;
+    float4 weights;
+};
+
+uniform Params g_params;
+RWStructuredBuffer<float> result;
+
+[shader("compute")]
+[numthreads(1, 1, 1)]
+void main(uint3 tid : SV_DispatchThreadID)
+{
+    result[0] = g_params.exposure + g_params.frame + g_params.transform[0][0] + g_params.weights.w;
+}
+)SHADER";
+
+static const char* SHADER_STRUCT_OTHER_SOURCE = R"SHADER(
+struct Params {
+    uint2 resolution;
+    uint exposure;
+    uint frame;
+    float4x4 transform;
+    float4 weights;
+};
+
+uniform Params g_params;
+RWStructuredBuffer<float> result;
+
+[shader("compute")]
+[numthreads(1, 1, 1)]
+void main(uint3 tid : SV_DispatchThreadID)
+{
+    result[0] = g_params.exposure;
+}
+)SHADER";
+
+TEST_SUITE_BEGIN("device");
+
+TEST_CASE_GPU("shader_struct")
+{
+    ref<SlangModule> module = ctx.device->load_module_from_source("test_shader_struct", SHADER_STRUCT_SOURCE);
+    ref<ShaderProgram> program = ctx.device->link_program({module}, {module->entry_point("main")});
+    ref<ShaderObject> root_object = ctx.device->create_root_shader_object(program);
+    ShaderCursor cursor(root_object);
+
+    SUBCASE("matching layout")
+    {
+        ShaderStructBinding<TestParams> binding("g_params");
+        TestParams params{};
+        params.exposure = 2.f;
+        params.frame = 3;
+        CHECK_NOTHROW(binding.write(cursor, params));
+        CHECK_NOTHROW(binding.write(cursor, params));
+    }
+
+    SUBCASE("multiple programs")
+    {
+        // The binding validates the layout again for every program it is written to.
+        ref<SlangModule> other_module
+            = ctx.device->load_module_from_source("test_shader_struct_other", SHADER_STRUCT_OTHER_SOURCE);
+        ref<ShaderProgram> other_program
+            = ctx.device->link_program({other_module}, {other_module->entry_point("main")});
+        ref<ShaderObject> other_root_object = ctx.device->create_root_shader_object(other_program);
+        ShaderStructBinding<TestParams> binding("g_params");
+        CHECK_NOTHROW(binding.write(cursor, TestParams{}));
+        CHECK_THROWS(binding.write(ShaderCursor(other_root_object), TestParams{}));
+        CHECK_NOTHROW(binding.write(cursor, TestParams{}));
+    }
+
+    SUBCASE("dispatch")
+    {
+        ShaderStructBinding<TestParams> binding("g_params");
+        TestParams params{};
+        params.resolution = uint2(640, 480);
+        params.exposure = 2.f;
+        params.frame = 3;
+        params.transform = float4x4::identity();
+        params.weights = float4(0.f, 0.f, 0.f, 4.f);
+
+        ref<Buffer> buffer = ctx.device->create_buffer({
+            .element_count = 1,
+            .struct_size = 4,
+            .usage = BufferUsage::shader_resource | BufferUsage::unordered_access,
+        });
+
+        ref<ComputeKernel> kernel = ctx.device->create_compute_kernel({.program = program});
+        kernel->dispatch(
+            uint3(1, 1, 1),
+            [&](ShaderCursor kernel_cursor)
+            {
+                binding.write(kernel_cursor, params);
+                kernel_cursor["result"] = buffer;
+            }
+        );
+
+        float result = 0.f;
+        buffer->get_data(&result, sizeof(result));
+        CHECK_EQ(result, 10.f);
+    }
+
+    SUBCASE("missing field")
+    {
+        ShaderStructBinding<TestParamsMissingField> binding("g_params");
+        CHECK_THROWS(binding.write(cursor, TestParamsMissingField{}));
+    }
+
+    SUBCASE("wrong type")
+    {
+        ShaderStructBinding<TestParamsWrongType> binding("g_params");
+        CHECK_THROWS(binding.write(cursor, TestParamsWrongType{}));
+    }
+
+    SUBCASE("invalid path")
+    {
+        ShaderStructBinding<TestParams> binding("g_missing");
+        CHECK_THROWS(binding.write(cursor, TestParams{}));
+    }
+}
+
+TEST_SUITE_END();
@@ -576,5 +576,45 @@ def test_copy_texture_to_buffer_and_back(
             idx += 1
 
 
+@pytest.mark.parametrize("device_type", helpers.DEFAULT_DEVICE_TYPES)
+def test_texture_to_bitmap(device_type: sgl.DeviceType):
+    device = helpers.get_device(device_type)
+
+    # Use an odd width so rows are not naturally aligned.
+    data = np.random.rand(17, 33, 4).astype(np.float32)
+    tex = device.create_texture(
+        format=sgl.Format.rgba32_float,
+        width=33,
+        height=17,
+        usage=sgl.TextureUsage.shader_resource,
+        data=data,
+    )
+
+    bitmap = tex.to_bitmap()
+    assert bitmap.width == 33
+    assert bitmap.height == 17
+    assert np.allclose(np.array(bitmap, copy=False), data)
+
+    # Read into a preallocated bitmap.
+    bitmap2 = sgl.Bitmap(
+        pixel_format=sgl.Bitmap.PixelFormat.rgba,
+        component_type=sgl.Bitmap.ComponentType.float32,
+        width=33,
+        height=17,
+    )
+    tex.to_bitmap(bitmap2)
+    assert np.allclose(np.array(bitmap2, copy=False), data)
+
+    # Mismatching bitmaps are rejected.
+    bitmap3 = sgl.Bitmap(
+        pixel_format=sgl.Bitmap.PixelFormat.rgba,
+        component_type=sgl.Bitmap.ComponentType.float32,
+        width=16,
+        height=16,
+    )
+    with pytest.raises(Exception):
+        tex.to_bitmap(bitmap3)
+
+
 if __name__ == "__main__":
     pytest.main([__file__, "-v"])
@@ -0,0 +1,118 @@
+# SPDX-License-Identifier: Apache-2.0
+
+import pytest
+import sgl
+import sys
+from pathlib import Path
+
+sys.path.append(str(Path(__file__).parent))
+import sglhelpers as helpers
+
+
+@pytest.mark.parametrize("device_type", helpers.DEFAULT_DEVICE_TYPES)
+def test_transient_resource_pool_recycle(device_type: sgl.DeviceType):
+    device = helpers.get_device(device_type)
+
+    pool = device.create_transient_resource_pool()
+
+    texture_desc = {
+        "format": sgl.Format.rgba8_unorm,
+        "width": 64,
+        "height": 64,
+        "usage": sgl.TextureUsage.shader_resource | sgl.TextureUsage.unordered_access,
+    }
+    buffer_desc = {
+        "size": 1024,
+        "usage": sgl.BufferUsage.unordered_access,
+    }
+
+    # Simulate a few frames, recycling resources once the previous frame finished.
+    textures = set()
+    for _ in range(4):
+        texture = pool.acquire_texture(texture_desc)
+        buffer = pool.acquire_buffer(buffer_desc)
+        textures.add(texture)
+        assert pool.stats.in_use_count == 2
+        pool.release_texture(texture)
+        pool.release_buffer(buffer)
+        device.submit_command_buffer(device.create_command_encoder().finish())
+        device.wait_for_idle()
+
+    stats = pool.stats
+    assert stats.created_count == 2
+    assert stats.reused_count == 6
+    assert stats.in_use_count == 0
+    assert stats.free_count == 2
+    assert len(textures) == 1
+
+    # Different descriptors do not share resources.
+    texture = pool.acquire_texture({**texture_desc, "width": 32})
+    assert texture.width == 32
+    assert pool.stats.created_count == 3
+    pool.release_texture(texture)
+
+    pool.trim()
+    assert pool.stats.free_count <= 1
+
+
+@pytest.mark.parametrize("device_type", helpers.DEFAULT_DEVICE_TYPES)
+def test_transient_resource_pool_aliasing(device_type: sgl.DeviceType):
+    device = helpers.get_device(device_type)
+
+    buffer_desc = {"size": 1024, "usage": sgl.BufferUsage.unordered_access}
+
+    # Without aliasing, a resource released in the current submission is not reused.
+    pool = device.create_transient_resource_pool()
+    a = pool.acquire_buffer(buffer_desc)
+    pool.release_buffer(a)
+    b = pool.acquire_buffer(buffer_desc)
+    assert a != b
+
+    # With aliasing, it is reused straight away.
+    pool = device.create_transient_resource_pool(enable_aliasing=True)
+    a = pool.acquire_buffer(buffer_desc)
+    pool.release_buffer(a)
+    b = pool.acquire_buffer(buffer_desc)
+    assert a == b
+
+    # Resources are only reused for matching descriptions.
+    pool.release_buffer(b)
+    c = pool.acquire_buffer(
+        {**buffer_desc, "default_state": sgl.ResourceState.unordered_access}
+    )
+    assert c != b
+    pool.release_buffer(c)
+
+    upload_desc = {
+        "size": 1024,
+        "memory_type": sgl.MemoryType.upload,
+        "usage": sgl.BufferUsage.copy_source,
+    }
+    d = pool.acquire_buffer(upload_desc)
+    pool.release_buffer(d)
+    e = pool.acquire_buffer({**upload_desc, "persistent_map": True})
+    assert e != d
+    assert e.is_persistently_mapped
+
+
+@pytest.mark.parametrize("device_type", helpers.DEFAULT_DEVICE_TYPES)
+def test_transient_resource_pool_ownership(device_type: sgl.DeviceType):
+    device = helpers.get_device(device_type)
+
+    pool = device.create_transient_resource_pool()
+    buffer_desc = {"size": 1024, "usage": sgl.BufferUsage.unordered_access}
+
+    # The pool keeps acquired resources alive when all other references are dropped,
+    # so a new resource cannot take the address of an acquired one and be mistaken for it.
+    for _ in range(4):
+        pool.acquire_buffer(buffer_desc)
+    assert pool.stats.in_use_count == 4
+    for _ in range(4):
+        other = device.create_buffer(**buffer_desc)
+        with pytest.raises(RuntimeError):
+            pool.release_buffer(other)
+    assert pool.stats.in_use_count == 4
+
+
+if __name__ == "__main__":
+    pytest.main([__file__, "-v"])
@@ -0,0 +1,220 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "transient_resource_pool.h"
+
+#include "sgl/device/device.h"
+
+#include "sgl/core/error.h"
+#include "sgl/core/hash.h"
+
+namespace sgl {
+
+size_t TransientResourcePool::TextureKeyHasher::operator()(const TextureKey& key) const
+{
+    return hash(
+        key.type,
+        key.format,
+        key.width,
+        key.height,
+        key.depth,
+        key.array_length,
+        key.mip_count,
+        key.sample_count,
+        key.sample_quality,
+        key.memory_type,
+        key.usage,
+        key.default_state
+    );
+}
+
+size_t TransientResourcePool::BufferKeyHasher::operator()(const BufferKey& key) const
+{
+    return hash(
+        key.size,
+        key.element_count,
+        key.struct_size,
+        key.format,
+        key.memory_type,
+        key.usage,
+        key.default_state,
+        key.persistent_map
+    );
+}
+
+TransientResourcePool::TransientResourcePool(ref<Device> device, TransientResourcePoolDesc desc)
+    : DeviceResource(std::move(device))
+    , m_desc(std::move(desc))
+{
+}
+
+TransientResourcePool::~TransientResourcePool() { }
+
+ref<Texture> TransientResourcePool::acquire_texture(TextureDesc desc)
+{
+    SGL_CHECK(desc.data.empty(), "Transient textures cannot be created with initial data.");
+
+    TextureKey key{
+        .type = desc.type,
+        .format = desc.format,
+        .width = desc.width,
+        .height = desc.height,
+        .depth = desc.depth,
+        .array_length = desc.array_length,
+        .mip_count = desc.mip_count,
+        .sample_count = desc.sample_count,
+        .sample_quality = desc.sample_quality,
+        .memory_type = desc.memory_type,
+        .usage = desc.usage,
+        .default_state = desc.default_state,
+    };
+
+    std::lock_guard lock(m_mutex);
+
+    ref<Texture> texture = try_reuse(m_textures, key);
+    if (!texture) {
+        texture = m_device->create_texture(std::move(desc));
+        m_created_count++;
+    }
+    m_textures.in_use.insert_or_assign(texture.get(), InUseEntry<Texture, TextureKey>{texture, key});
+    return texture;
+}
+
+ref<Buffer> TransientResourcePool::acquire_buffer(BufferDesc desc)
+{
+    SGL_CHECK(desc.data == nullptr, "Transient buffers cannot be created with initial data.");
+    SGL_CHECK(!desc.struct_type, "Transient buffers cannot be created from a struct type, use 'struct_size'.");
+
+    BufferKey key{
+        .size = desc.size,
+        .element_count = desc.element_count,
+        .struct_size = desc.struct_size,
+        .format = desc.format,
+        .memory_type = desc.memory_type,
+        .usage = desc.usage,
+        .default_state = desc.default_state,
+        .persistent_map = desc.persistent_map,
+    };
+
+    std::lock_guard lock(m_mutex);
+
+    ref<Buffer> buffer = try_reuse(m_buffers, key);
+    if (!buffer) {
+        buffer = m_device->create_buffer(std::move(desc));
+        m_created_count++;
+    }
+    m_buffers.in_use.insert_or_assign(buffer.get(), InUseEntry<Buffer, BufferKey>{buffer, key});
+    return buffer;
+}
+
+void TransientResourcePool::release_texture(Texture* texture)
+{
+    SGL_CHECK_NOT_NULL(texture);
+    std::lock_guard lock(m_mutex);
+    release(m_textures, texture);
+}
+
+void TransientResourcePool::release_buffer(Buffer* buffer)
+{
+    SGL_CHECK_NOT_NULL(buffer);
+    std::lock_guard lock(m_mutex);
+    release(m_buffers, buffer);
+}
+
+void TransientResourcePool::trim()
+{
+    std::lock_guard lock(m_mutex);
+
+    auto trim_cache = [this](auto& cache)
+    {
+        for (auto it = cache.free.begin(); it != cache.free.end();) {
+            std::erase_if(
+                it->second,
+                [this](const auto& entry) { return m_device->is_submit_finished(entry.submit_id); }
+            );
+            it = it->second.empty() ? cache.free.erase(it) : std::next(it);
+        }
+    };
+    trim_cache(m_textures);
+    trim_cache(m_buffers);
+}
+
+TransientResourcePoolStats TransientResourcePool::stats() const
+{
+    std::lock_guard lock(m_mutex);
+
+    TransientResourcePoolStats stats{
+        .created_count = m_created_count,
+        .reused_count = m_reused_count,
+        .in_use_count = m_textures.in_use.size() + m_buffers.in_use.size(),
+    };
+    for (const auto& [key, entries] : m_textures.free)
+        stats.free_count += entries.size();
+    for (const auto& [key, entries] : m_buffers.free)
+        stats.free_count += entries.size();
+    return stats;
+}
+
+std::string TransientResourcePool::to_string() const
+{
+    TransientResourcePoolStats stats = this->stats();
+    return fmt::format(
+        "TransientResourcePool(\n"
+        "  device = {},\n"
+        "  enable_aliasing = {},\n"
+        "  created_count = {},\n"
+        "  in_use_count = {},\n"
+        "  free_count = {}\n"
+        ")",
+        m_device,
+        m_desc.enable_aliasing,
+        stats.created_count,
+        stats.in_use_count,
+        stats.free_count
+    );
+}
+
+bool TransientResourcePool::is_reusable(uint64_t submit_id) const
+{
+    // Resources released in the current submission are still referenced by work that
+    // has not been submitted yet, which is only safe to alias in recording order.
+    if (submit_id > m_device->last_submit_id())
+        return m_desc.enable_aliasing && submit_id == m_device->last_submit_id() + 1;
+    return m_device->is_submit_finished(submit_id);
+}
+
+template<typename T, typename Key, typename Hasher>
+ref<T> TransientResourcePool::try_reuse(ResourceCache<T, Key, Hasher>& cache, const Key& key)
+{
+    auto it = cache.free.find(key);
+    if (it == cache.free.end())
+        return nullptr;
+
+    std::vector<FreeEntry<T>>& entries = it->second;
+    for (size_t i = 0; i < entries.size(); ++i) {
+        if (is_reusable(entries[i].submit_id)) {
+            std::swap(entries[i], entries.back());
+            ref<T> resource = std::move(entries.back().resource);
+            entries.pop_back();
+            m_reused_count++;
+            return resource;
+        }
+    }
+    return nullptr;
+}
+
+template<typename T, typename Key, typename Hasher>
+void TransientResourcePool::release(ResourceCache<T, Key, Hasher>& cache, const T* resource)
+{
+    auto it = cache.in_use.find(resource);
+    SGL_CHECK(it != cache.in_use.end(), "Resource was not acquired from this pool.");
+
+    // The resource may be used by work recorded but not yet submitted,
+    // so it can only be recycled once the next submission has finished.
+    cache.free[it->second.key].push_back({
+        .resource = std::move(it->second.resource),
+        .submit_id = m_device->last_submit_id() + 1,
+    });
+    cache.in_use.erase(it);
+}
+
+} // namespace sgl
@@ -0,0 +1,165 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "sgl/device/fwd.h"
+#include "sgl/device/types.h"
+#include "sgl/device/resource.h"
+#include "sgl/device/device_resource.h"
+
+#include "sgl/core/macros.h"
+#include "sgl/core/object.h"
+
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace sgl {
+
+struct TransientResourcePoolDesc {
+    /// Allow reusing resources released within the current (not yet submitted) submission.
+    /// This aliases resources with non-overlapping lifetimes in recording order, and is only
+    /// safe if command buffers are submitted in the order they are recorded.
+    bool enable_aliasing{false};
+};
+
+struct TransientResourcePoolStats {
+    /// Number of resources created by the pool.
+    size_t created_count{0};
+    /// Number of acquisitions served by recycling a resource.
+    size_t reused_count{0};
+    /// Number of resources currently acquired.
+    size_t in_use_count{0};
+    /// Number of resources currently available for recycling.
+    size_t free_count{0};
+};
+
+/**
+ * Pool of transient textures and buffers, keyed by their descriptor.
+ *
+ * Resources are acquired for the duration of a frame (or render graph pass) and released
+ * back to the pool once they are no longer recorded into. A released resource is recycled
+ * once the submission following its release has finished executing, so that steady-state
+ * frames do not create any resources. The pool holds a reference to acquired resources until
+ * they are released.
+ */
+class SGL_API TransientResourcePool : public DeviceResource {
+    SGL_OBJECT(TransientResourcePool)
+public:
+    TransientResourcePool(ref<Device> device, TransientResourcePoolDesc desc);
+    ~TransientResourcePool();
+
+    const TransientResourcePoolDesc& desc() const { return m_desc; }
+
+    /**
+     * Acquire a texture matching the given descriptor.
+     * The debug label is only applied to newly created textures.
+     *
+     * \param desc Texture descriptor. Initial data is not supported.
+     * \return Texture object.
+     */
+    ref<Texture> acquire_texture(TextureDesc desc);
+
+    /**
+     * Acquire a buffer matching the given descriptor.
+     * The debug label is only applied to newly created buffers.
+     *
+     * \param desc Buffer descriptor. Initial data is not supported.
+     * \return Buffer object.
+     */
+    ref<Buffer> acquire_buffer(BufferDesc desc);
+
+    /// Release a texture acquired from this pool.
+    void release_texture(Texture* texture);
+
+    /// Release a buffer acquired from this pool.
+    void release_buffer(Buffer* buffer);
+
+    /// Destroy all released resources whose last use has finished executing.
+    void trim();
+
+    /// Get pool statistics.
+    TransientResourcePoolStats stats() const;
+
+    std::string to_string() const override;
+
+private:
+    struct TextureKey {
+        TextureType type;
+        Format format;
+        uint32_t width;
+        uint32_t height;
+        uint32_t depth;
+        uint32_t array_length;
+        uint32_t mip_count;
+        uint32_t sample_count;
+        uint32_t sample_quality;
+        MemoryType memory_type;
+        TextureUsage usage;
+        ResourceState default_state;
+
+        bool operator==(const TextureKey&) const = default;
+    };
+
+    struct BufferKey {
+        size_t size;
+        size_t element_count;
+        size_t struct_size;
+        Format format;
+        MemoryType memory_type;
+        BufferUsage usage;
+        ResourceState default_state;
+        bool persistent_map;
+
+        bool operator==(const BufferKey&) const = default;
+    };
+
+    struct TextureKeyHasher {
+        size_t operator()(const TextureKey& key) const;
+    };
+
+    struct BufferKeyHasher {
+        size_t operator()(const BufferKey& key) const;
+    };
+
+    template<typename T>
+    struct FreeEntry {
+        ref<T> resource;
+        uint64_t submit_id;
+    };
+
+    template<typename T, typename Key>
+    struct InUseEntry {
+        /// Keeps the resource alive, so its address cannot be reused by another object until released.
+        ref<T> resource;
+        Key key;
+    };
+
+    template<typename T, typename Key, typename Hasher>
+    struct ResourceCache {
+        std::unordered_map<Key, std::vector<FreeEntry<T>>, Hasher> free;
+        std::unordered_map<const T*, InUseEntry<T, Key>> in_use;
+    };
+
+    /// Returns true if a resource released at \c submit_id can be reused.
+    bool is_reusable(uint64_t submit_id) const;
+
+    /// Take a reusable resource matching \c key from the cache, or return nullptr.
+    template<typename T, typename Key, typename Hasher>
+    ref<T> try_reuse(ResourceCache<T, Key, Hasher>& cache, const Key& key);
+
+    template<typename T, typename Key, typename Hasher>
+    void release(ResourceCache<T, Key, Hasher>& cache, const T* resource);
+
+    TransientResourcePoolDesc m_desc;
+
+    ResourceCache<Texture, TextureKey, TextureKeyHasher> m_textures;
+    ResourceCache<Buffer, BufferKey, BufferKeyHasher> m_buffers;
+
+    size_t m_created_count{0};
+    size_t m_reused_count{0};
+
+    mutable std::mutex m_mutex;
+};
+
+} // namespace sgl
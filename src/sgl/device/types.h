@@ -21,14 +21,23 @@ using DeviceOffset = uint64_t;
 /// Represents a size in device memory (in bytes).
 using DeviceSize = uint64_t;
 
+/// Command queue type.
+/// \note The compute and transfer queues are experimental. slang-rhi currently only exposes a
+/// graphics queue, so they are emulated on it and do not execute concurrently with graphics work.
 enum CommandQueueType : uint32_t {
     graphics = static_cast<uint32_t>(rhi::QueueType::Graphics),
+    /// Asynchronous compute queue (no render passes).
+    compute,
+    /// Transfer queue (copy, upload and clear commands only).
+    transfer,
 };
 
 SGL_ENUM_INFO(
     CommandQueueType,
     {
         {CommandQueueType::graphics, "graphics"},
+        {CommandQueueType::compute, "compute"},
+        {CommandQueueType::transfer, "transfer"},
     }
 );
 SGL_ENUM_REGISTER(CommandQueueType);
@@ -656,6 +656,51 @@ static const char *__doc_sgl_AspectBlendDesc_op = R"doc()doc";
 
 static const char *__doc_sgl_AspectBlendDesc_src_factor = R"doc()doc";
 
+static const char *__doc_sgl_AsyncReadback =
+R"doc(Handle to an asynchronous read back, created by
+``CommandEncoder::read_buffer_async`` or
+``CommandEncoder::read_texture_async``. The data is held in a pooled
+read back buffer that is returned to the device when the handle is
+released.)doc";
+
+static const char *__doc_sgl_AsyncReadback_AsyncReadback = R"doc()doc";
+
+static const char *__doc_sgl_AsyncReadback_class_name = R"doc()doc";
+
+static const char *__doc_sgl_AsyncReadback_data =
+R"doc(Get a pointer to the read back data. Waits for the read back to
+finish.)doc";
+
+static const char *__doc_sgl_AsyncReadback_is_ready =
+R"doc(True if the read back has finished and the data can be accessed
+without blocking.)doc";
+
+static const char *__doc_sgl_AsyncReadback_is_submitted =
+R"doc(True if the command buffer containing the read back has been
+submitted.)doc";
+
+static const char *__doc_sgl_AsyncReadback_layout =
+R"doc(Subresource layout of the data (texture read backs only).)doc";
+
+static const char *__doc_sgl_AsyncReadback_read =
+R"doc(Copy the read back data to host memory. Waits for the read back to
+finish.)doc";
+
+static const char *__doc_sgl_AsyncReadback_size = R"doc(Size of the read back data in bytes.)doc";
+
+static const char *__doc_sgl_AsyncReadback_submit_id =
+R"doc(Submit ID of the command buffer containing the read back (0 if not yet
+submitted).)doc";
+
+static const char *__doc_sgl_AsyncReadback_to_numpy =
+R"doc(Copy the read back data to a numpy array of bytes. Waits for the read
+back to finish. Texture read backs are returned in their raw layout
+(see ``layout``).)doc";
+
+static const char *__doc_sgl_AsyncReadback_to_string = R"doc()doc";
+
+static const char *__doc_sgl_AsyncReadback_wait = R"doc(Wait for the read back to finish.)doc";
+
 static const char *__doc_sgl_BaseReflectionIndexedList =
 R"doc(Base class for read-only lazy evaluation list of search results. To
 use it, the search function (e.g. children_of_kind) fills out the
@@ -729,12 +774,141 @@ static const char *__doc_sgl_BaseReflectionObjectImpl_slang_target = R"doc()doc"
 
 static const char *__doc_sgl_BaseReflectionObject_BaseReflectionObject = R"doc()doc";
 
-static const char *__doc_sgl_BaseReflectionObject_hot_reload_invalidate = R"doc()doc";
+static const char *__doc_sgl_BaseReflectionObject_hot_reload_invalidate =
+R"doc(Invalidate the wrapper, returning the reference to its owner so it can
+be released by the caller.)doc";
 
 static const char *__doc_sgl_BaseReflectionObject_is_valid = R"doc()doc";
 
 static const char *__doc_sgl_BaseReflectionObject_m_owner = R"doc()doc";
 
+static const char *__doc_sgl_BindlessResourceTable =
+R"doc(Device level table of textures, buffers and samplers that shaders can
+index directly.
+
+Resources are added to the table once and referenced by a stable
+index, which shaders use through the accessors in
+``sgl/device/bindless.slang`` (``BindlessTexture``, ``BindlessBuffer``
+and ``BindlessSampler``). Indices of removed resources are reused by
+later additions.
+
+The table is exposed to shaders as the global parameter block
+``g_bindless_resources``, which is bound automatically when a pipeline
+is bound. The table keeps one shader object per program, so binding
+the table costs a single object binding per dispatch. The object is
+patched one slot at a time when resources are added or removed. Once
+it has been bound, the next change drops it instead and the next bind
+builds a new one, so adding, removing or replacing a resource never
+affects work already recorded, even if it has not been submitted yet.)doc";
+
+static const char *__doc_sgl_BindlessResourceTableDesc = R"doc()doc";
+
+static const char *__doc_sgl_BindlessResourceTableDesc_buffer_capacity = R"doc(Number of buffer slots.)doc";
+
+static const char *__doc_sgl_BindlessResourceTableDesc_sampler_capacity = R"doc(Number of sampler slots.)doc";
+
+static const char *__doc_sgl_BindlessResourceTableDesc_texture_capacity = R"doc(Number of texture slots.)doc";
+
+static const char *__doc_sgl_BindlessResourceTable_BindlessResourceTable = R"doc()doc";
+
+static const char *__doc_sgl_BindlessResourceTable_CachedObject = R"doc()doc";
+
+static const char *__doc_sgl_BindlessResourceTable_CachedObject_bound =
+R"doc(True if the object has been bound since it was built, i.e. recorded
+work may reference it.)doc";
+
+static const char *__doc_sgl_BindlessResourceTable_CachedObject_flat_layouts =
+R"doc(Flattened type layouts of the program at the time the object was
+built. Keeps the program's layout alive and identifies the object as
+outdated after a reload.)doc";
+
+static const char *__doc_sgl_BindlessResourceTable_CachedObject_shader_object = R"doc()doc";
+
+static const char *__doc_sgl_BindlessResourceTable_Slots = R"doc()doc";
+
+static const char *__doc_sgl_BindlessResourceTable_Slots_count = R"doc()doc";
+
+static const char *__doc_sgl_BindlessResourceTable_Slots_free_indices = R"doc()doc";
+
+static const char *__doc_sgl_BindlessResourceTable_Slots_resources = R"doc()doc";
+
+static const char *__doc_sgl_BindlessResourceTable_add = R"doc()doc";
+
+static const char *__doc_sgl_BindlessResourceTable_add_buffer =
+R"doc(Add a buffer to the table. The buffer is bound as
+``ByteAddressBuffer`` in shaders.
+
+Returns:
+    Index of the buffer.)doc";
+
+static const char *__doc_sgl_BindlessResourceTable_add_sampler =
+R"doc(Add a sampler to the table.
+
+Returns:
+    Index of the sampler.)doc";
+
+static const char *__doc_sgl_BindlessResourceTable_add_texture =
+R"doc(Add a texture to the table. The texture is bound as ``Texture2D`` in
+shaders.
+
+Returns:
+    Index of the texture.)doc";
+
+static const char *__doc_sgl_BindlessResourceTable_bind =
+R"doc(Bind the table to the ``g_bindless_resources`` parameter block of a
+root shader object. Does nothing if the shader does not use the table.
+
+Parameter ``cursor``:
+    Cursor to the root shader object.
+
+Parameter ``program``:
+    Program the root shader object was created for.)doc";
+
+static const char *__doc_sgl_BindlessResourceTable_buffer_count = R"doc(Number of buffers in the table.)doc";
+
+static const char *__doc_sgl_BindlessResourceTable_class_name = R"doc()doc";
+
+static const char *__doc_sgl_BindlessResourceTable_desc = R"doc()doc";
+
+static const char *__doc_sgl_BindlessResourceTable_m_buffers = R"doc()doc";
+
+static const char *__doc_sgl_BindlessResourceTable_m_cached_objects =
+R"doc(Shader objects built for the parameter block layouts of bound
+programs. Entries are removed when their program is destroyed.)doc";
+
+static const char *__doc_sgl_BindlessResourceTable_m_desc = R"doc()doc";
+
+static const char *__doc_sgl_BindlessResourceTable_m_device = R"doc()doc";
+
+static const char *__doc_sgl_BindlessResourceTable_m_mutex = R"doc()doc";
+
+static const char *__doc_sgl_BindlessResourceTable_m_samplers = R"doc()doc";
+
+static const char *__doc_sgl_BindlessResourceTable_m_textures = R"doc()doc";
+
+static const char *__doc_sgl_BindlessResourceTable_release_program =
+R"doc(Drop the shader object cached for a program. Called when the program
+is destroyed.)doc";
+
+static const char *__doc_sgl_BindlessResourceTable_remove = R"doc()doc";
+
+static const char *__doc_sgl_BindlessResourceTable_remove_buffer =
+R"doc(Remove a buffer from the table, releasing its index.)doc";
+
+static const char *__doc_sgl_BindlessResourceTable_remove_sampler =
+R"doc(Remove a sampler from the table, releasing its index.)doc";
+
+static const char *__doc_sgl_BindlessResourceTable_remove_texture =
+R"doc(Remove a texture from the table, releasing its index.)doc";
+
+static const char *__doc_sgl_BindlessResourceTable_sampler_count = R"doc(Number of samplers in the table.)doc";
+
+static const char *__doc_sgl_BindlessResourceTable_texture_count = R"doc(Number of textures in the table.)doc";
+
+static const char *__doc_sgl_BindlessResourceTable_to_string = R"doc()doc";
+
+static const char *__doc_sgl_BindlessResourceTable_update_slot = R"doc(Write a slot of all cached shader objects.)doc";
+
 static const char *__doc_sgl_Bitmap = R"doc()doc";
 
 static const char *__doc_sgl_Bitmap_Bitmap = R"doc()doc";
@@ -1080,6 +1254,20 @@ static const char *__doc_sgl_Blitter_m_program_cache = R"doc()doc";
 
 static const char *__doc_sgl_Buffer = R"doc()doc";
 
+static const char *__doc_sgl_BufferColumn =
+R"doc(Host data for a single field of a range of elements, see
+``BufferCursor::write_columns``.)doc";
+
+static const char *__doc_sgl_BufferColumn_data = R"doc(Field values, one tightly packed value per element.)doc";
+
+static const char *__doc_sgl_BufferColumn_path = R"doc(Field path within an element (see ``BufferFieldAccessor``).)doc";
+
+static const char *__doc_sgl_BufferColumn_size = R"doc(Size of the data in bytes.)doc";
+
+static const char *__doc_sgl_BufferColumn_type =
+R"doc(Scalar type of the values, converted to the scalar type of the field
+if different.)doc";
+
 static const char *__doc_sgl_BufferCursor =
 R"doc(Represents a list of elements in a block of memory, and provides
 simple interface to get a BufferElementCursor for each one. As this
@@ -1106,7 +1294,17 @@ R"doc(Create as a view onto a section of a buffer resource. Disable
 load_before_write to prevent automatic loading of current buffer state
 before writing data to it.)doc";
 
-static const char *__doc_sgl_BufferCursor_apply = R"doc(In case of GPU only buffers, pushes all data to the GPU.)doc";
+static const char *__doc_sgl_BufferCursor_PAGE_SIZE =
+R"doc(Granularity of dirty tracking and lazy loading for cursors onto a
+buffer resource.)doc";
+
+static const char *__doc_sgl_BufferCursor_apply =
+R"doc(In case of GPU only buffers, pushes modified data to the GPU. Only
+dirty pages are uploaded, with adjacent pages coalesced into a single
+copy.)doc";
+
+static const char *__doc_sgl_BufferCursor_dirty_size =
+R"doc(Number of bytes that will be uploaded by the next call to ``apply``.)doc";
 
 static const char *__doc_sgl_BufferCursor_element_count = R"doc(Number of elements in the buffer.)doc";
 
@@ -1122,7 +1320,9 @@ static const char *__doc_sgl_BufferCursor_find_element = R"doc(Get element at a
 
 static const char *__doc_sgl_BufferCursor_is_loaded = R"doc(Check if internal buffer exists.)doc";
 
-static const char *__doc_sgl_BufferCursor_load = R"doc(In case of GPU only buffers, loads all data from GPU.)doc";
+static const char *__doc_sgl_BufferCursor_load =
+R"doc(In case of GPU only buffers, loads all data from GPU. Discards any
+changes that have not been applied.)doc";
 
 static const char *__doc_sgl_BufferCursor_m_buffer = R"doc()doc";
 
@@ -1140,13 +1340,33 @@ static const char *__doc_sgl_BufferCursor_m_size = R"doc()doc";
 
 static const char *__doc_sgl_BufferCursor_operator_array = R"doc(Index operator to get element at a given index.)doc";
 
-static const char *__doc_sgl_BufferCursor_read_data = R"doc(Reads data from buffer (note: reads only from host memory).)doc";
+static const char *__doc_sgl_BufferCursor_read_data =
+R"doc(Reads data from buffer (note: reads only from host memory). For
+cursors onto a buffer resource, pages are loaded on first access.)doc";
 
 static const char *__doc_sgl_BufferCursor_resource = R"doc(Get the resource this cursor represents (if any).)doc";
 
 static const char *__doc_sgl_BufferCursor_size = R"doc(Size of whole buffer.)doc";
 
-static const char *__doc_sgl_BufferCursor_write_data = R"doc(Write data to buffer (note: writes only to host memory).)doc";
+static const char *__doc_sgl_BufferCursor_write_columns =
+R"doc(Write fields of a range of elements from column data.
+
+Each column is scattered into the strided element layout in a single
+native pass. Values whose scalar type differs from the field's scalar
+type are converted with a ``StructConverter``.
+
+Parameter ``columns``:
+    Columns to write.
+
+Parameter ``first``:
+    Index of the first element.
+
+Parameter ``count``:
+    Number of elements.)doc";
+
+static const char *__doc_sgl_BufferCursor_write_data =
+R"doc(Write data to buffer (note: writes only to host memory). For cursors
+onto a buffer resource, the written pages are marked dirty.)doc";
 
 static const char *__doc_sgl_BufferDesc = R"doc()doc";
 
@@ -1166,6 +1386,14 @@ static const char *__doc_sgl_BufferDesc_label = R"doc(Debug label.)doc";
 
 static const char *__doc_sgl_BufferDesc_memory_type = R"doc(Memory type.)doc";
 
+static const char *__doc_sgl_BufferDesc_persistent_map =
+R"doc(Keep the buffer mapped for its whole lifetime. Only valid for
+``MemoryType::upload`` and ``MemoryType::read_back``. rhi exposes no
+explicit flush/invalidate, so persistent maps rely on host coherent
+memory: host writes are visible to work submitted afterwards, and
+device writes are visible once the submission writing them has
+finished.)doc";
+
 static const char *__doc_sgl_BufferDesc_size = R"doc(Buffer size in bytes.)doc";
 
 static const char *__doc_sgl_BufferDesc_struct_size = R"doc(Struct size in bytes.)doc";
@@ -1176,6 +1404,118 @@ size of the struct.)doc";
 
 static const char *__doc_sgl_BufferDesc_usage = R"doc(Resource usage flags.)doc";
 
+static const char *__doc_sgl_BufferHeap =
+R"doc(Sub-allocating heap for many small buffers.
+
+Allocations are rounded up to power of two size classes and carved out
+of backing buffers (pages). Each page serves a single size class. The
+first page of a size class holds a few blocks, each further page
+doubles in size up to ``BufferHeapDesc::page_size``. Requests larger
+than the page size get a dedicated backing buffer.
+
+Freed blocks are recycled once the last submission at the time of
+release has finished executing, or immediately if no submission is
+pending. As with ``Buffer``, an allocation must be kept alive until
+the commands referencing it are submitted.)doc";
+
+static const char *__doc_sgl_BufferHeapAllocation =
+R"doc(A slice of a backing buffer handed out by a ``BufferHeap``. The block
+is returned to the heap when the allocation is released.)doc";
+
+static const char *__doc_sgl_BufferHeapAllocation_BufferHeapAllocation = R"doc()doc";
+
+static const char *__doc_sgl_BufferHeapAllocation_buffer = R"doc(Backing buffer.)doc";
+
+static const char *__doc_sgl_BufferHeapAllocation_buffer_offset_pair =
+R"doc(Buffer and offset pair, for use in vertex/index buffer bindings and
+copies.)doc";
+
+static const char *__doc_sgl_BufferHeapAllocation_class_name = R"doc()doc";
+
+static const char *__doc_sgl_BufferHeapAllocation_create_view = R"doc(Create a view of the allocation.)doc";
+
+static const char *__doc_sgl_BufferHeapAllocation_device_address = R"doc(Device address of the allocation.)doc";
+
+static const char *__doc_sgl_BufferHeapAllocation_get_data = R"doc(Get allocation data to host memory.)doc";
+
+static const char *__doc_sgl_BufferHeapAllocation_m_buffer = R"doc()doc";
+
+static const char *__doc_sgl_BufferHeapAllocation_m_heap = R"doc()doc";
+
+static const char *__doc_sgl_BufferHeapAllocation_m_offset = R"doc()doc";
+
+static const char *__doc_sgl_BufferHeapAllocation_m_page =
+R"doc(Page the block was carved from (nullptr for dedicated allocations).)doc";
+
+static const char *__doc_sgl_BufferHeapAllocation_m_size = R"doc()doc";
+
+static const char *__doc_sgl_BufferHeapAllocation_offset = R"doc(Offset of the allocation in the backing buffer.)doc";
+
+static const char *__doc_sgl_BufferHeapAllocation_set_data = R"doc(Set allocation data from host memory.)doc";
+
+static const char *__doc_sgl_BufferHeapAllocation_size = R"doc(Requested size in bytes.)doc";
+
+static const char *__doc_sgl_BufferHeapAllocation_to_string = R"doc()doc";
+
+static const char *__doc_sgl_BufferHeapDesc = R"doc()doc";
+
+static const char *__doc_sgl_BufferHeapDesc_label = R"doc(Debug label.)doc";
+
+static const char *__doc_sgl_BufferHeapDesc_memory_type = R"doc(Memory type of the backing buffers.)doc";
+
+static const char *__doc_sgl_BufferHeapDesc_min_block_size =
+R"doc(Smallest size class in bytes. Also the alignment of all allocations.)doc";
+
+static const char *__doc_sgl_BufferHeapDesc_page_size = R"doc(Maximum size of each backing buffer (page) in bytes.)doc";
+
+static const char *__doc_sgl_BufferHeapDesc_usage = R"doc(Resource usage flags of the backing buffers.)doc";
+
+static const char *__doc_sgl_BufferHeapStats = R"doc()doc";
+
+static const char *__doc_sgl_BufferHeapStats_allocated_size =
+R"doc(Total size of blocks handed out in bytes (including size class
+rounding).)doc";
+
+static const char *__doc_sgl_BufferHeapStats_allocation_count = R"doc(Number of live allocations.)doc";
+
+static const char *__doc_sgl_BufferHeapStats_fragmentation =
+R"doc(Fraction of allocated memory lost to size class rounding.)doc";
+
+static const char *__doc_sgl_BufferHeapStats_occupancy =
+R"doc(Fraction of reserved memory occupied by live or pending blocks.)doc";
+
+static const char *__doc_sgl_BufferHeapStats_page_count = R"doc(Number of backing buffers.)doc";
+
+static const char *__doc_sgl_BufferHeapStats_pending_free_size =
+R"doc(Total size of freed blocks waiting for their submission to finish in
+bytes.)doc";
+
+static const char *__doc_sgl_BufferHeapStats_requested_size =
+R"doc(Total size requested by live allocations in bytes.)doc";
+
+static const char *__doc_sgl_BufferHeapStats_reserved_size = R"doc(Total size of the backing buffers in bytes.)doc";
+
+static const char *__doc_sgl_BufferHeap_BufferHeap = R"doc()doc";
+
+static const char *__doc_sgl_BufferHeap_allocate =
+R"doc(Allocate a block from the heap.
+
+Parameter ``size``:
+    Size in bytes.
+
+Returns:
+    New allocation.)doc";
+
+static const char *__doc_sgl_BufferHeap_class_name = R"doc()doc";
+
+static const char *__doc_sgl_BufferHeap_desc = R"doc()doc";
+
+static const char *__doc_sgl_BufferHeap_stats = R"doc(Get heap statistics.)doc";
+
+static const char *__doc_sgl_BufferHeap_to_string = R"doc()doc";
+
+static const char *__doc_sgl_BufferHeap_trim = R"doc(Release pages that have no live or pending allocations.)doc";
+
 static const char *__doc_sgl_BufferElementCursor =
 R"doc(Represents a single element of a given type in a block of memory, and
 provides read/write tools to access its members via reflection.)doc";
@@ -1232,6 +1572,11 @@ static const char *__doc_sgl_BufferElementCursor_set_matrix = R"doc()doc";
 
 static const char *__doc_sgl_BufferElementCursor_set_scalar = R"doc()doc";
 
+static const char *__doc_sgl_BufferElementCursor_set_unchecked =
+R"doc(Write a scalar, vector or matrix value without type checks. The caller
+is responsible for ``T`` matching the field type. With
+``SGL_ENABLE_CURSOR_DEBUG_CHECKS``, this behaves like ``set``.)doc";
+
 static const char *__doc_sgl_BufferElementCursor_set_vector = R"doc()doc";
 
 static const char *__doc_sgl_BufferElementCursor_slang_type_layout = R"doc()doc";
@@ -1244,6 +1589,107 @@ static const char *__doc_sgl_BufferElementCursor_type_layout = R"doc()doc";
 
 static const char *__doc_sgl_BufferElementCursor_write_data = R"doc()doc";
 
+static const char *__doc_sgl_BufferFieldAccessor =
+R"doc(Field path within the elements of a buffer cursor, resolved once and
+reused for many elements.
+
+Indexing a ``BufferElementCursor`` by name looks up the field in the
+type layout on every access. An accessor resolves a path such as
+"transform" or "lights[2].color" up front and caches the resulting
+type layout and byte offset, so accessing the field of an element is
+reduced to an offset computation. Fields of a range of elements can
+also be read and written in bulk from tightly packed host memory.)doc";
+
+static const char *__doc_sgl_BufferFieldAccessor_BufferFieldAccessor = R"doc()doc";
+
+static const char *__doc_sgl_BufferFieldAccessor_BufferFieldAccessor_2 =
+R"doc(Resolve a field path for the elements of a buffer cursor. Fields are
+separated by '.' and array, vector and matrix elements are selected
+with "[index]".)doc";
+
+static const char *__doc_sgl_BufferFieldAccessor_check_range = R"doc()doc";
+
+static const char *__doc_sgl_BufferFieldAccessor_cursor = R"doc(The buffer cursor this accessor refers to.)doc";
+
+static const char *__doc_sgl_BufferFieldAccessor_find_element =
+R"doc(Get a cursor to the field of the element at a given index.)doc";
+
+static const char *__doc_sgl_BufferFieldAccessor_get = R"doc()doc";
+
+static const char *__doc_sgl_BufferFieldAccessor_get_range =
+R"doc(Read the field of a range of elements.
+
+Parameter ``first``:
+    Index of the first element.
+
+Parameter ``count``:
+    Number of elements.
+
+Parameter ``data``:
+    Destination for the field values, tightly packed (``count`` *
+    ``size()`` bytes).)doc";
+
+static const char *__doc_sgl_BufferFieldAccessor_is_valid = R"doc()doc";
+
+static const char *__doc_sgl_BufferFieldAccessor_m_cursor = R"doc()doc";
+
+static const char *__doc_sgl_BufferFieldAccessor_m_offset = R"doc()doc";
+
+static const char *__doc_sgl_BufferFieldAccessor_m_path = R"doc()doc";
+
+static const char *__doc_sgl_BufferFieldAccessor_m_type_layout = R"doc()doc";
+
+static const char *__doc_sgl_BufferFieldAccessor_offset = R"doc(Offset of the field within an element in bytes.)doc";
+
+static const char *__doc_sgl_BufferFieldAccessor_operator_array =
+R"doc(Index operator to get a cursor to the field of the element at a given
+index.)doc";
+
+static const char *__doc_sgl_BufferFieldAccessor_path = R"doc(The field path.)doc";
+
+static const char *__doc_sgl_BufferFieldAccessor_set = R"doc()doc";
+
+static const char *__doc_sgl_BufferFieldAccessor_set_range =
+R"doc(Write the field of a range of elements.
+
+Parameter ``first``:
+    Index of the first element.
+
+Parameter ``count``:
+    Number of elements.
+
+Parameter ``data``:
+    Field values, tightly packed (``count`` * ``size()`` bytes).)doc";
+
+static const char *__doc_sgl_BufferFieldAccessor_set_range_2 =
+R"doc(Write the field of a range of elements from values of a different
+scalar type.
+
+Values are converted to the scalar type of the field with a
+``StructConverter``. The field must be a scalar, vector or matrix (or
+an array thereof) without padding.
+
+Parameter ``first``:
+    Index of the first element.
+
+Parameter ``count``:
+    Number of elements.
+
+Parameter ``data``:
+    Field values, tightly packed.
+
+Parameter ``size``:
+    Size of the data in bytes.
+
+Parameter ``type``:
+    Scalar type of the values.)doc";
+
+static const char *__doc_sgl_BufferFieldAccessor_size = R"doc(Size of the field in bytes.)doc";
+
+static const char *__doc_sgl_BufferFieldAccessor_to_string = R"doc()doc";
+
+static const char *__doc_sgl_BufferFieldAccessor_type_layout = R"doc(Type layout of the field.)doc";
+
 static const char *__doc_sgl_BufferOffsetPair = R"doc()doc";
 
 static const char *__doc_sgl_BufferOffsetPair_BufferOffsetPair = R"doc()doc";
@@ -1370,6 +1816,10 @@ static const char *__doc_sgl_Buffer_shared_handle = R"doc(Get the shared resourc
 
 static const char *__doc_sgl_Buffer_is_mapped = R"doc(Returns true if buffer is currently mapped.)doc";
 
+static const char *__doc_sgl_Buffer_is_persistently_mapped =
+R"doc(Returns true if buffer is persistently mapped (see
+``BufferDesc::persistent_map``).)doc";
+
 static const char *__doc_sgl_Buffer_m_cuda_memory = R"doc()doc";
 
 static const char *__doc_sgl_Buffer_m_desc = R"doc()doc";
@@ -1380,7 +1830,9 @@ static const char *__doc_sgl_Buffer_m_rhi_buffer = R"doc()doc";
 
 static const char *__doc_sgl_Buffer_map =
 R"doc(Map the whole buffer. Only available for buffers created with
-``MemoryType::upload`` or ``MemoryType::read_back``.)doc";
+``MemoryType::upload`` or ``MemoryType::read_back``. Returns the
+persistent mapping for buffers created with
+``BufferDesc::persistent_map``.)doc";
 
 static const char *__doc_sgl_Buffer_map_2 = R"doc()doc";
 
@@ -1414,7 +1866,7 @@ static const char *__doc_sgl_Buffer_struct_size = R"doc()doc";
 
 static const char *__doc_sgl_Buffer_to_string = R"doc()doc";
 
-static const char *__doc_sgl_Buffer_unmap = R"doc(Unmap the buffer.)doc";
+static const char *__doc_sgl_Buffer_unmap = R"doc(Unmap the buffer. No-op for persistently mapped buffers.)doc";
 
 static const char *__doc_sgl_ColorTargetDesc = R"doc()doc";
 
@@ -1669,6 +2121,45 @@ static const char *__doc_sgl_CommandEncoder_push_debug_group = R"doc(Push a debu
 
 static const char *__doc_sgl_CommandEncoder_query_acceleration_structure_properties = R"doc()doc";
 
+static const char *__doc_sgl_CommandEncoder_read_buffer_async =
+R"doc(Read back a buffer region asynchronously.
+
+Records a copy of the region into a pooled read back buffer. The
+returned handle becomes readable once the command buffer has been
+submitted and has finished executing, without blocking the submission.
+
+Parameter ``buffer``:
+    Buffer to read from.
+
+Parameter ``offset``:
+    Offset in bytes.
+
+Parameter ``size``:
+    Size in bytes.
+
+Returns:
+    Read back handle.)doc";
+
+static const char *__doc_sgl_CommandEncoder_read_texture_async =
+R"doc(Read back a texture subresource asynchronously.
+
+Records a copy of the subresource into a pooled read back buffer,
+using the layout returned by ``Texture::get_subresource_layout``. The
+returned handle becomes readable once the command buffer has been
+submitted and has finished executing.
+
+Parameter ``texture``:
+    Texture to read from.
+
+Parameter ``layer``:
+    Layer index.
+
+Parameter ``mip``:
+    Mip level.
+
+Returns:
+    Read back handle.)doc";
+
 static const char *__doc_sgl_CommandEncoder_resolve_query = R"doc()doc";
 
 static const char *__doc_sgl_CommandEncoder_rhi_command_encoder = R"doc()doc";
@@ -1738,7 +2229,13 @@ Parameter ``query_pool``:
 Parameter ``index``:
     Index of the query.)doc";
 
-static const char *__doc_sgl_CommandQueueType = R"doc()doc";
+static const char *__doc_sgl_CommandQueueType =
+R"doc(Command queue type. \note The compute and transfer queues are
+experimental. slang-rhi currently only exposes a graphics queue, so
+they are emulated on it and do not execute concurrently with graphics
+work.)doc";
+
+static const char *__doc_sgl_CommandQueueType_compute = R"doc(Asynchronous compute queue (no render passes).)doc";
 
 static const char *__doc_sgl_CommandQueueType_graphics = R"doc()doc";
 
@@ -1748,6 +2245,9 @@ static const char *__doc_sgl_CommandQueueType_info_items = R"doc()doc";
 
 static const char *__doc_sgl_CommandQueueType_info_name = R"doc()doc";
 
+static const char *__doc_sgl_CommandQueueType_transfer =
+R"doc(Transfer queue (copy, upload and clear commands only).)doc";
+
 static const char *__doc_sgl_ComparisonFunc = R"doc()doc";
 
 static const char *__doc_sgl_ComparisonFunc_always = R"doc()doc";
@@ -1782,14 +2282,29 @@ static const char *__doc_sgl_ComputeKernel_ComputeKernel = R"doc()doc";
 
 static const char *__doc_sgl_ComputeKernel_class_name = R"doc()doc";
 
+static const char *__doc_sgl_ComputeKernel_create_root_object =
+R"doc(Create a persistent root shader object for this kernel.
+
+The object can be populated once and passed to ``dispatch``
+repeatedly, writing only the fields that changed in between
+dispatches.)doc";
+
 static const char *__doc_sgl_ComputeKernel_dispatch = R"doc()doc";
 
+static const char *__doc_sgl_ComputeKernel_dispatch_2 =
+R"doc(Dispatch the kernel with all bindings recorded in a persistent root
+shader object.)doc";
+
+static const char *__doc_sgl_ComputeKernel_dispatch_impl = R"doc()doc";
+
 static const char *__doc_sgl_ComputeKernel_m_pipeline = R"doc()doc";
 
 static const char *__doc_sgl_ComputeKernel_m_thread_group_size = R"doc()doc";
 
 static const char *__doc_sgl_ComputeKernel_pipeline = R"doc()doc";
 
+static const char *__doc_sgl_ComputeKernel_thread_group_size = R"doc(Thread group size of the compute entry point.)doc";
+
 static const char *__doc_sgl_ComputePassEncoder = R"doc()doc";
 
 static const char *__doc_sgl_ComputePassEncoder_bind_pipeline = R"doc()doc";
@@ -1965,6 +2480,10 @@ static const char *__doc_sgl_CursorMode_info_name = R"doc()doc";
 
 static const char *__doc_sgl_CursorMode_normal = R"doc(The cursor is visible and behaves normally.)doc";
 
+static const char *__doc_sgl_CursorValueTraits =
+R"doc(Describes a host value type that can be written through cursors
+without conversion.)doc";
+
 static const char *__doc_sgl_DDSFile = R"doc(Helper class for loading DDS files.)doc";
 
 static const char *__doc_sgl_DDSFile_DDSFile = R"doc()doc";
@@ -2261,8 +2780,13 @@ static const char *__doc_sgl_DeviceDesc = R"doc()doc";
 
 static const char *__doc_sgl_DeviceDesc_adapter_luid = R"doc(Adapter LUID to select adapter on which the device will be created.)doc";
 
+static const char *__doc_sgl_DeviceDesc_bindless_desc = R"doc(Capacities of the bindless resource table.)doc";
+
 static const char *__doc_sgl_DeviceDesc_compiler_options = R"doc(Compiler options (used for default slang session).)doc";
 
+static const char *__doc_sgl_DeviceDesc_enable_bindless =
+R"doc(Enable the bindless resource table (see ``BindlessResourceTable``).)doc";
+
 static const char *__doc_sgl_DeviceDesc_enable_cuda_interop = R"doc(Enable CUDA interoperability.)doc";
 
 static const char *__doc_sgl_DeviceDesc_enable_debug_layers = R"doc(Enable debug layers.)doc";
@@ -2273,12 +2797,28 @@ Currently windows and linux only.)doc";
 
 static const char *__doc_sgl_DeviceDesc_enable_print = R"doc(Enable device side printing (adds performance overhead).)doc";
 
+static const char *__doc_sgl_DeviceDesc_enable_upload_batching =
+R"doc(Enable batching of buffer and texture uploads. When enabled, uploads
+via ``Device::upload_buffer_data`` and ``Device::upload_texture_data``
+(and therefore ``Buffer::set_data`` on device local buffers) are
+recorded into a shared command encoder instead of being submitted one
+by one. Pending uploads are submitted before the command buffers of
+the next submission, when waiting for the device or reading back data,
+when the batch size threshold is exceeded, or explicitly with
+``Device::flush_uploads``. Batched uploads are therefore observed by
+all subsequently submitted work, exactly as if they were submitted
+immediately.)doc";
+
 static const char *__doc_sgl_DeviceDesc_shader_cache_path =
 R"doc(Path to the shader cache directory (optional). If a relative path is
 used, the cache is stored in the application data directory.)doc";
 
 static const char *__doc_sgl_DeviceDesc_type = R"doc(The type of the device.)doc";
 
+static const char *__doc_sgl_DeviceDesc_upload_batch_size =
+R"doc(Size threshold (in bytes) at which pending batched uploads are
+flushed.)doc";
+
 static const char *__doc_sgl_DeviceInfo = R"doc()doc";
 
 static const char *__doc_sgl_DeviceInfo_adapter_luid = R"doc(The logically unique identifier of the graphics adapter.)doc";
@@ -2371,6 +2911,8 @@ static const char *__doc_sgl_DeviceType_wgpu = R"doc()doc";
 
 static const char *__doc_sgl_Device_Device = R"doc()doc";
 
+static const char *__doc_sgl_Device_bindless_table = R"doc(Bindless resource table (nullptr if not enabled).)doc";
+
 static const char *__doc_sgl_Device_blitter = R"doc()doc";
 
 static const char *__doc_sgl_Device_class_name = R"doc()doc";
@@ -2390,6 +2932,30 @@ device is to be destroyed at runtime, it must be closed explicitly.)doc";
 
 static const char *__doc_sgl_Device_close_all_devices = R"doc(Close all open devices.)doc";
 
+static const char *__doc_sgl_Device_collect_deferred_releases =
+R"doc(Release objects from the deferred release queue.
+
+Destroyed buffers, textures and acceleration structures that may still
+be referenced by in-flight submissions are not freed immediately but
+put on a deferred release queue. Objects are freed once the
+submissions that were pending at the time of destruction have finished
+executing. The queue is processed incrementally on every submit and
+fully in ``wait_for_idle``, so calling this explicitly is only needed
+to free memory earlier.
+
+Resources are not tracked per submission, so any object destroyed
+while a submission is pending is deferred, even if it was never used
+on the GPU. Each object stays queued only until the submissions
+pending at its destruction have finished (and the next collection), so
+the queue is bounded by the objects destroyed during the lifetime of
+those submissions.
+
+Parameter ``max_count``:
+    Maximum number of objects to release (0 for no limit).
+
+Returns:
+    Number of released objects.)doc";
+
 static const char *__doc_sgl_Device_create = R"doc()doc";
 
 static const char *__doc_sgl_Device_create_acceleration_structure = R"doc()doc";
@@ -2439,7 +3005,31 @@ Returns:
 
 static const char *__doc_sgl_Device_create_buffer_view = R"doc()doc";
 
-static const char *__doc_sgl_Device_create_command_encoder = R"doc()doc";
+static const char *__doc_sgl_Device_create_buffer_heap =
+R"doc(Create a new buffer heap for sub-allocating many small buffers.
+
+Parameter ``memory_type``:
+    Memory type of the backing buffers.
+
+Parameter ``usage``:
+    Resource usage flags of the backing buffers.
+
+Parameter ``page_size``:
+    Size of each backing buffer (page) in bytes.
+
+Parameter ``min_block_size``:
+    Smallest size class in bytes.
+
+Parameter ``label``:
+    Debug label.
+
+Returns:
+    New buffer heap object.)doc";
+
+static const char *__doc_sgl_Device_create_command_encoder =
+R"doc(Create a command encoder for the given queue. This is thread-safe, but
+each encoder must only be used by one thread at a time. \note Compute
+and transfer queues are experimental (see ``CommandQueueType``).)doc";
 
 static const char *__doc_sgl_Device_create_compute_kernel = R"doc()doc";
 
@@ -2618,10 +3208,22 @@ static const char *__doc_sgl_Device_create_texture_from_resource = R"doc()doc";
 
 static const char *__doc_sgl_Device_create_texture_view = R"doc()doc";
 
+static const char *__doc_sgl_Device_create_transient_resource_pool =
+R"doc(Create a new pool for recycling transient textures and buffers.
+
+Parameter ``enable_aliasing``:
+    Allow reusing resources released within the current submission.
+
+Returns:
+    New transient resource pool object.)doc";
+
 static const char *__doc_sgl_Device_cuda_device = R"doc()doc";
 
 static const char *__doc_sgl_Device_debug_printer = R"doc()doc";
 
+static const char *__doc_sgl_Device_deferred_release_count =
+R"doc(Number of objects waiting on the deferred release queue.)doc";
+
 static const char *__doc_sgl_Device_desc = R"doc()doc";
 
 static const char *__doc_sgl_Device_enable_agility_sdk =
@@ -2649,6 +3251,10 @@ static const char *__doc_sgl_Device_flush_print = R"doc(Block and flush all shad
 
 static const char *__doc_sgl_Device_flush_print_to_string = R"doc(Block and flush all shader side debug print output to a string.)doc";
 
+static const char *__doc_sgl_Device_flush_uploads =
+R"doc(Submit any pending batched uploads (see
+``DeviceDesc::enable_upload_batching``).)doc";
+
 static const char *__doc_sgl_Device_get_acceleration_structure_sizes =
 R"doc(Query the device for buffer sizes required for acceleration structure
 builds.
@@ -2663,7 +3269,8 @@ static const char *__doc_sgl_Device_get_format_support = R"doc(Returns the suppo
 
 static const char *__doc_sgl_Device_get_native_command_queue_handle =
 R"doc(Returns the native API handle for the command queue: - D3D12:
-ID3D12CommandQueue* - Vulkan: VkQueue (Vulkan))doc";
+ID3D12CommandQueue* - Vulkan: VkQueue (Vulkan) Throws for the compute
+and transfer queues, which are emulated on the graphics queue.)doc";
 
 static const char *__doc_sgl_Device_native_handles =
 R"doc(Returns the native API handle: - D3D12: ID3D12Device* (0) - Vulkan:
@@ -2688,6 +3295,9 @@ Parameter ``id``:
 Returns:
     True if the command buffer is complete.)doc";
 
+static const char *__doc_sgl_Device_last_submit_id =
+R"doc(ID of the last submission (0 if nothing has been submitted yet).)doc";
+
 static const char *__doc_sgl_Device_link_program = R"doc()doc";
 
 static const char *__doc_sgl_Device_load_module = R"doc()doc";
@@ -2696,6 +3306,8 @@ static const char *__doc_sgl_Device_load_module_from_source = R"doc()doc";
 
 static const char *__doc_sgl_Device_load_program = R"doc()doc";
 
+static const char *__doc_sgl_Device_m_bindless_table = R"doc()doc";
+
 static const char *__doc_sgl_Device_m_blitter = R"doc()doc";
 
 static const char *__doc_sgl_Device_m_closed = R"doc()doc";
@@ -2740,8 +3352,32 @@ static const char *__doc_sgl_Device_m_supports_cuda_interop = R"doc()doc";
 
 static const char *__doc_sgl_Device_m_wait_global_fence = R"doc()doc";
 
+static const char *__doc_sgl_Device_memory_tracker =
+R"doc(Memory tracker aggregating the memory usage of all live resources.)doc";
+
 static const char *__doc_sgl_Device_on_hot_reload = R"doc(Called by hot reload system after reload occurs, to trigger the hooks.)doc";
 
+static const char *__doc_sgl_Device_pending_upload_size =
+R"doc(Size in bytes of the currently pending batched uploads.)doc";
+
+static const char *__doc_sgl_Device_queue_wait_for_submit =
+R"doc(Make a queue wait for work submitted to other queues.
+
+The next submission to ``queue`` waits on the device (without blocking
+the host) until all submissions to the other queues up to and
+including ``submit_id`` have finished. Submission IDs are shared
+across queues, so any ID returned by a submit can be passed.
+
+\note This API is experimental. All queues are currently emulated on
+the graphics queue, so the wait only orders submissions and does not
+enable concurrent execution.
+
+Parameter ``queue``:
+    Command queue that waits.
+
+Parameter ``submit_id``:
+    Submission ID to wait for.)doc";
+
 static const char *__doc_sgl_Device_read_buffer_data =
 R"doc(Read buffer data to host memory. \note This will wait until the data
 is copied back to host memory.
@@ -2774,6 +3410,49 @@ Parameter ``mip``:
 Returns:
     Subresource data in host memory.)doc";
 
+static const char *__doc_sgl_Device_read_texture_data_2 =
+R"doc(Read texture data into caller provided host memory. The data is read
+back into a staging blob, from which rows are repacked to the
+destination row pitch in a single copy (no additional host allocation
+is made). \note This will wait until the data is copied back to host
+memory.
+
+Parameter ``texture``:
+    Texture to read from.
+
+Parameter ``layer``:
+    Layer index.
+
+Parameter ``mip``:
+    Mip level.
+
+Parameter ``data``:
+    Destination memory.
+
+Parameter ``size``:
+    Size of the destination memory in bytes.
+
+Parameter ``row_pitch``:
+    Destination row pitch in bytes (0 for tightly packed rows).)doc";
+
+static const char *__doc_sgl_Device_record_parallel =
+R"doc(Record command buffers in parallel on the global thread pool.
+
+Each callback is invoked on a worker thread with its own command
+encoder and must only record independent work. Pipelines and shader
+programs should be created up front, as shader compilation is not
+thread-safe. Blocks until all callbacks have finished. Must not be
+called from a task running on the global thread pool.
+
+Parameter ``callbacks``:
+    Callbacks recording commands.
+
+Parameter ``queue``:
+    Command queue to record for.
+
+Returns:
+    Command buffers, in the order of the callbacks.)doc";
+
 static const char *__doc_sgl_Device_register_device_close_callback = R"doc(Register a device close callback, called at start of device close.)doc";
 
 static const char *__doc_sgl_Device_register_shader_hot_reload_callback =
@@ -2811,6 +3490,21 @@ Parameter ``queue``:
 Returns:
     Submission ID.)doc";
 
+static const char *__doc_sgl_Device_submit_parallel =
+R"doc(Record command buffers in parallel and submit them in order.
+
+Records the command buffers using ``record_parallel`` and submits them
+in a single submission, in the order of the callbacks.
+
+Parameter ``callbacks``:
+    Callbacks recording commands.
+
+Parameter ``queue``:
+    Command queue to submit to.
+
+Returns:
+    Submission ID.)doc";
+
 static const char *__doc_sgl_Device_supported_shader_model = R"doc(The highest shader model supported by the device.)doc";
 
 static const char *__doc_sgl_Device_supports_cuda_interop = R"doc(True if the device supports CUDA interoperability.)doc";
@@ -3169,6 +3863,101 @@ static const char *__doc_sgl_FillMode_solid = R"doc()doc";
 
 static const char *__doc_sgl_FillMode_wireframe = R"doc()doc";
 
+static const char *__doc_sgl_FlatTypeLayout =
+R"doc(Flattened copy of the layout information of a slang type layout.
+
+Cursors navigate and type check shader data on every access. Querying
+this through the slang reflection API involves many small out-of-line
+calls, so the information is gathered once per type layout into this
+compact table. Tables are owned by a ``FlatTypeLayoutCache`` and link
+to the tables of their fields and elements, so cursors navigate
+without lookups.)doc";
+
+static const char *__doc_sgl_FlatTypeLayoutCache =
+R"doc(Owner of flattened type layouts (see ``FlatTypeLayout``).
+
+Tables are keyed by the slang type layout and live as long as the
+cache. A cache must only be queried with type layouts that stay alive
+as long as the cache, so that a key can never refer to a type layout
+that was freed and reallocated. Caches are therefore held by the
+objects that own the slang type layouts: shader programs, shader
+objects and type layout reflection objects.)doc";
+
+static const char *__doc_sgl_FlatTypeLayoutCache_FlatTypeLayoutCache =
+R"doc(Constructor.
+
+Parameter ``owner``:
+    Object keeping the slang type layouts alive (optional).)doc";
+
+static const char *__doc_sgl_FlatTypeLayoutCache_class_name = R"doc()doc";
+
+static const char *__doc_sgl_FlatTypeLayoutCache_get =
+R"doc(Get the flattened layout of a slang type layout, building it and all
+nested layouts on first use.)doc";
+
+static const char *__doc_sgl_FlatTypeLayoutCache_get_or_build = R"doc()doc";
+
+static const char *__doc_sgl_FlatTypeLayoutCache_m_layouts = R"doc()doc";
+
+static const char *__doc_sgl_FlatTypeLayoutCache_m_mutex = R"doc()doc";
+
+static const char *__doc_sgl_FlatTypeLayoutCache_m_owner = R"doc()doc";
+
+static const char *__doc_sgl_FlatTypeLayout_Field = R"doc()doc";
+
+static const char *__doc_sgl_FlatTypeLayout_Field_binding_range_offset =
+R"doc(Binding range offset of the field relative to the struct.)doc";
+
+static const char *__doc_sgl_FlatTypeLayout_Field_layout = R"doc(Flattened layout of the field.)doc";
+
+static const char *__doc_sgl_FlatTypeLayout_Field_name = R"doc(Field name.)doc";
+
+static const char *__doc_sgl_FlatTypeLayout_Field_name_hash = R"doc(Hash of the field name.)doc";
+
+static const char *__doc_sgl_FlatTypeLayout_Field_type_layout = R"doc(Type layout of the field.)doc";
+
+static const char *__doc_sgl_FlatTypeLayout_Field_uniform_offset = R"doc(Uniform offset of the field in bytes.)doc";
+
+static const char *__doc_sgl_FlatTypeLayout_checked_value_type =
+R"doc(Host value type (see ``cursor_utils::value_type_key``) that last
+passed the cursor type checks for this layout. Cursors skip the checks
+for repeated writes of the same value type.)doc";
+
+static const char *__doc_sgl_FlatTypeLayout_element_count =
+R"doc(Number of elements (arrays, vectors and matrices only).)doc";
+
+static const char *__doc_sgl_FlatTypeLayout_element_layout =
+R"doc(Flattened layout of elements (arrays, vectors and matrices only).)doc";
+
+static const char *__doc_sgl_FlatTypeLayout_element_stride =
+R"doc(Uniform stride of elements in bytes (arrays, vectors and matrices
+only).)doc";
+
+static const char *__doc_sgl_FlatTypeLayout_element_type_layout =
+R"doc(Type layout of elements (arrays, vectors and matrices only).)doc";
+
+static const char *__doc_sgl_FlatTypeLayout_fields = R"doc(Fields (structs only).)doc";
+
+static const char *__doc_sgl_FlatTypeLayout_find_field = R"doc(Find a field by name. Returns nullptr if not found.)doc";
+
+static const char *__doc_sgl_FlatTypeLayout_kind = R"doc()doc";
+
+static const char *__doc_sgl_FlatTypeLayout_leaf_col_count =
+R"doc(Column count of the type with all array dimensions unwrapped.)doc";
+
+static const char *__doc_sgl_FlatTypeLayout_leaf_kind =
+R"doc(Kind of the type with all array dimensions unwrapped.)doc";
+
+static const char *__doc_sgl_FlatTypeLayout_leaf_row_count =
+R"doc(Row count of the type with all array dimensions unwrapped.)doc";
+
+static const char *__doc_sgl_FlatTypeLayout_leaf_scalar_type =
+R"doc(Scalar type of the type with all array dimensions unwrapped.)doc";
+
+static const char *__doc_sgl_FlatTypeLayout_parameter_category = R"doc()doc";
+
+static const char *__doc_sgl_FlatTypeLayout_type_layout = R"doc(The slang type layout.)doc";
+
 static const char *__doc_sgl_Format = R"doc(Resource formats.)doc";
 
 static const char *__doc_sgl_FormatChannels = R"doc()doc";
@@ -4258,6 +5047,38 @@ static const char *__doc_sgl_LogicOp_info_name = R"doc()doc";
 
 static const char *__doc_sgl_LogicOp_no_op = R"doc()doc";
 
+static const char *__doc_sgl_MemoryBudgetEvent = R"doc(Event data for memory budget callbacks.)doc";
+
+static const char *__doc_sgl_MemoryBudgetEvent_budget = R"doc(Memory budget in bytes.)doc";
+
+static const char *__doc_sgl_MemoryBudgetEvent_exceeded =
+R"doc(True if usage rose above the threshold, false if it dropped below.)doc";
+
+static const char *__doc_sgl_MemoryBudgetEvent_threshold =
+R"doc(Threshold that was crossed, as a fraction of the budget.)doc";
+
+static const char *__doc_sgl_MemoryBudgetEvent_usage = R"doc(Device memory usage in bytes.)doc";
+
+static const char *__doc_sgl_MemoryCategory = R"doc()doc";
+
+static const char *__doc_sgl_MemoryCategoryStats = R"doc()doc";
+
+static const char *__doc_sgl_MemoryCategoryStats_count = R"doc(Number of live objects.)doc";
+
+static const char *__doc_sgl_MemoryCategoryStats_current = R"doc(Current memory usage in bytes.)doc";
+
+static const char *__doc_sgl_MemoryCategoryStats_peak = R"doc(Peak memory usage in bytes.)doc";
+
+static const char *__doc_sgl_MemoryCategory_acceleration_structure = R"doc(Acceleration structures.)doc";
+
+static const char *__doc_sgl_MemoryCategory_buffer = R"doc(Device local buffers.)doc";
+
+static const char *__doc_sgl_MemoryCategory_shader_object = R"doc(Shader objects (host memory for uniform data).)doc";
+
+static const char *__doc_sgl_MemoryCategory_staging = R"doc(Upload and read back buffers.)doc";
+
+static const char *__doc_sgl_MemoryCategory_texture = R"doc(Textures.)doc";
+
 static const char *__doc_sgl_MemoryMappedFile = R"doc(Utility class for reading memory-mapped files.)doc";
 
 static const char *__doc_sgl_MemoryMappedFileStream = R"doc()doc";
@@ -4412,6 +5233,52 @@ static const char *__doc_sgl_MemoryStream_truncate = R"doc()doc";
 
 static const char *__doc_sgl_MemoryStream_write = R"doc()doc";
 
+static const char *__doc_sgl_MemoryTracker =
+R"doc(Tracks memory of all live resources created on a device.
+
+Resources register their memory on creation and unregister it on
+destruction. Usage is aggregated per ``MemoryCategory`` and per debug
+label. An optional budget invokes the registered callbacks whenever
+device memory usage crosses one of the budget thresholds. Shader
+objects account for host memory and are excluded from the device
+memory usage.)doc";
+
+static const char *__doc_sgl_MemoryTracker_budget = R"doc(Device memory budget in bytes (0 if disabled).)doc";
+
+static const char *__doc_sgl_MemoryTracker_device_usage =
+R"doc(Current device memory usage in bytes (all categories except shader
+objects).)doc";
+
+static const char *__doc_sgl_MemoryTracker_peak_device_usage = R"doc(Peak device memory usage in bytes.)doc";
+
+static const char *__doc_sgl_MemoryTracker_register_budget_callback =
+R"doc(Register a callback invoked when device memory usage crosses a budget
+threshold.)doc";
+
+static const char *__doc_sgl_MemoryTracker_reset_peak = R"doc(Reset peak usage to the current usage.)doc";
+
+static const char *__doc_sgl_MemoryTracker_set_budget =
+R"doc(Set the device memory budget.
+
+Parameter ``budget``:
+    Budget in bytes (0 to disable).
+
+Parameter ``thresholds``:
+    Thresholds as fractions of the budget at which callbacks are
+    invoked.)doc";
+
+static const char *__doc_sgl_MemoryTracker_stats = R"doc(Statistics of a single category.)doc";
+
+static const char *__doc_sgl_MemoryTracker_track = R"doc(Register memory of a newly created object.)doc";
+
+static const char *__doc_sgl_MemoryTracker_untrack =
+R"doc(Unregister memory of a destroyed object. Arguments must match the call
+to ``track``.)doc";
+
+static const char *__doc_sgl_MemoryTracker_update = R"doc()doc";
+
+static const char *__doc_sgl_MemoryTracker_usage_by_label = R"doc(Current memory usage in bytes per debug label.)doc";
+
 static const char *__doc_sgl_MemoryType = R"doc()doc";
 
 static const char *__doc_sgl_MemoryType_device_local = R"doc()doc";
@@ -4794,6 +5661,17 @@ static const char *__doc_sgl_Object_to_string =
 R"doc(Return a string representation of this object. This is used for
 debugging purposes.)doc";
 
+static const char *__doc_sgl_Object_try_inc_ref =
+R"doc(Increase the object's reference count unless the last reference has
+already been released. This allows a non-owning cache to safely revive
+objects that may be destroyed concurrently. Objects owned by Python
+are never revived, as that requires the GIL (see ``ScopedGILPy``).
+While the GIL is held they cannot be destroyed concurrently, so
+``inc_ref`` can be used instead.
+
+Returns:
+    True if the reference count was increased.)doc";
+
 static const char *__doc_sgl_OwnedSubresourceData = R"doc()doc";
 
 static const char *__doc_sgl_OwnedSubresourceData_owned_data = R"doc()doc";
@@ -4821,6 +5699,96 @@ static const char *__doc_sgl_PassEncoder_pop_debug_group = R"doc(Pop a debug gro
 
 static const char *__doc_sgl_PassEncoder_push_debug_group = R"doc(Push a debug group.)doc";
 
+static const char *__doc_sgl_PersistentShaderObject =
+R"doc(Shader object that records writes so they can be replayed into other
+shader objects.
+
+The root shader object returned by
+``ComputePassEncoder::bind_pipeline`` is transient and needs to be
+populated for every dispatch. A persistent shader object is populated
+once, typically through a ``ShaderCursor``, and then applied to the
+root object of each dispatch. Between dispatches, only fields that
+changed need to be written again. Resources and samplers stay bound
+until they are overwritten or ``clear`` is called.
+
+Uniform data is kept in a host side copy and is replayed with one
+``set_data`` call per contiguous range that was written. Entry points
+and sub-objects returned by ``get_entry_point`` and ``get_object`` are
+persistent shader objects themselves. Sub-objects (parameter blocks
+and constant buffers) are replayed into a shader object with the
+shadow copy enabled that is kept across replays and bound to each
+target, so only their uniform data that changed since the last replay
+is uploaded. CUDA tensor views are wrapped in an interop buffer once,
+which is bound to and registered with the target on every replay.)doc";
+
+static const char *__doc_sgl_PersistentShaderObject_Binding = R"doc()doc";
+
+static const char *__doc_sgl_PersistentShaderObject_PersistentShaderObject =
+R"doc(Constructor.
+
+Parameter ``layout_object``:
+    Shader object used for reflection only. It is never written to.)doc";
+
+static const char *__doc_sgl_PersistentShaderObject_apply =
+R"doc(Replay all recorded writes into the ``target`` shader object.)doc";
+
+static const char *__doc_sgl_PersistentShaderObject_class_name = R"doc()doc";
+
+static const char *__doc_sgl_PersistentShaderObject_clear =
+R"doc(Remove all recorded writes, including those of entry points and sub-
+objects.)doc";
+
+static const char *__doc_sgl_PersistentShaderObject_get_cuda_interop_buffers = R"doc()doc";
+
+static const char *__doc_sgl_PersistentShaderObject_get_entry_point = R"doc()doc";
+
+static const char *__doc_sgl_PersistentShaderObject_get_object = R"doc()doc";
+
+static const char *__doc_sgl_PersistentShaderObject_m_bindings = R"doc()doc";
+
+static const char *__doc_sgl_PersistentShaderObject_m_data = R"doc(Host side copy of the uniform data.)doc";
+
+static const char *__doc_sgl_PersistentShaderObject_m_data_ranges =
+R"doc(Sorted, non-overlapping ranges [begin, end) of ``m_data`` that were
+written.)doc";
+
+static const char *__doc_sgl_PersistentShaderObject_m_entry_points = R"doc()doc";
+
+static const char *__doc_sgl_PersistentShaderObject_m_layout_object = R"doc()doc";
+
+static const char *__doc_sgl_PersistentShaderObject_m_materialized =
+R"doc(Shader object with shadow copy that sub-objects are replayed into (see
+``materialize``).)doc";
+
+static const char *__doc_sgl_PersistentShaderObject_m_sub_objects = R"doc()doc";
+
+static const char *__doc_sgl_PersistentShaderObject_materialize =
+R"doc(Replay the recorded writes of a sub-object into ``m_materialized`` and
+return it.)doc";
+
+static const char *__doc_sgl_PersistentShaderObject_set_acceleration_structure = R"doc()doc";
+
+static const char *__doc_sgl_PersistentShaderObject_set_binding = R"doc()doc";
+
+static const char *__doc_sgl_PersistentShaderObject_set_buffer = R"doc()doc";
+
+static const char *__doc_sgl_PersistentShaderObject_set_buffer_view = R"doc()doc";
+
+static const char *__doc_sgl_PersistentShaderObject_set_cuda_tensor_view = R"doc()doc";
+
+static const char *__doc_sgl_PersistentShaderObject_set_data = R"doc()doc";
+
+static const char *__doc_sgl_PersistentShaderObject_set_object = R"doc()doc";
+
+static const char *__doc_sgl_PersistentShaderObject_set_sampler = R"doc()doc";
+
+static const char *__doc_sgl_PersistentShaderObject_set_texture = R"doc()doc";
+
+static const char *__doc_sgl_PersistentShaderObject_set_texture_view = R"doc()doc";
+
+static const char *__doc_sgl_PersistentShaderObject_uniform_data_size =
+R"doc(Size of the recorded uniform data in bytes.)doc";
+
 static const char *__doc_sgl_Pipeline = R"doc(Pipeline base class.)doc";
 
 static const char *__doc_sgl_Pipeline_Pipeline = R"doc()doc";
@@ -4835,6 +5803,8 @@ a strong reference.)doc";
 
 static const char *__doc_sgl_Pipeline_notify_program_reloaded = R"doc()doc";
 
+static const char *__doc_sgl_Pipeline_program = R"doc()doc";
+
 static const char *__doc_sgl_Pipeline_recreate = R"doc()doc";
 
 static const char *__doc_sgl_PluginManager =
@@ -5692,6 +6662,20 @@ static const char *__doc_sgl_ScissorRect_min_y = R"doc()doc";
 
 static const char *__doc_sgl_ScissorRect_to_string = R"doc()doc";
 
+static const char *__doc_sgl_ScopedGILPy =
+R"doc(Holds the Python GIL for its lifetime.
+
+Uses the handlers installed with ``object_init_py`` and does nothing
+if Python support is not initialized. Acquiring the GIL is reentrant.)doc";
+
+static const char *__doc_sgl_ScopedGILPy_ScopedGILPy = R"doc()doc";
+
+static const char *__doc_sgl_ScopedGILPy_ScopedGILPy_2 = R"doc()doc";
+
+static const char *__doc_sgl_ScopedGILPy_m_state = R"doc()doc";
+
+static const char *__doc_sgl_ScopedGILPy_operator_assign = R"doc()doc";
+
 static const char *__doc_sgl_SearchPathsResolver = R"doc()doc";
 
 static const char *__doc_sgl_SearchPathsResolver_SearchPathsResolver = R"doc()doc";
@@ -5728,6 +6712,8 @@ static const char *__doc_sgl_ShaderCursor_find_entry_point = R"doc()doc";
 
 static const char *__doc_sgl_ShaderCursor_find_field = R"doc()doc";
 
+static const char *__doc_sgl_ShaderCursor_flat_layout = R"doc(Flattened layout of the type the cursor points to.)doc";
+
 static const char *__doc_sgl_ShaderCursor_has_element = R"doc()doc";
 
 static const char *__doc_sgl_ShaderCursor_has_field = R"doc()doc";
@@ -5736,6 +6722,10 @@ static const char *__doc_sgl_ShaderCursor_is_reference = R"doc()doc";
 
 static const char *__doc_sgl_ShaderCursor_is_valid = R"doc()doc";
 
+static const char *__doc_sgl_ShaderCursor_m_layout =
+R"doc(Flattened layout of ``m_type_layout``, used on the hot path instead of
+querying slang.)doc";
+
 static const char *__doc_sgl_ShaderCursor_m_offset = R"doc()doc";
 
 static const char *__doc_sgl_ShaderCursor_m_shader_object = R"doc()doc";
@@ -5778,8 +6768,20 @@ static const char *__doc_sgl_ShaderCursor_set_texture = R"doc()doc";
 
 static const char *__doc_sgl_ShaderCursor_set_texture_view = R"doc()doc";
 
+static const char *__doc_sgl_ShaderCursor_set_unchecked =
+R"doc(Write a scalar, vector or matrix value without type checks.
+
+The copy (including the row padding of matrices) is resolved at
+compile time from ``T``, so this is a plain copy into the shader
+object. The caller is responsible for ``T`` matching the field type.
+With ``SGL_ENABLE_CURSOR_DEBUG_CHECKS``, this behaves like ``set``.)doc";
+
+static const char *__doc_sgl_ShaderCursor_set_unchecked_2 = R"doc()doc";
+
 static const char *__doc_sgl_ShaderCursor_set_vector = R"doc()doc";
 
+static const char *__doc_sgl_ShaderCursor_shader_object = R"doc()doc";
+
 static const char *__doc_sgl_ShaderCursor_slang_type_layout = R"doc()doc";
 
 static const char *__doc_sgl_ShaderCursor_to_string = R"doc()doc";
@@ -5814,7 +6816,25 @@ static const char *__doc_sgl_ShaderModel_unknown = R"doc()doc";
 
 static const char *__doc_sgl_ShaderObject = R"doc()doc";
 
-static const char *__doc_sgl_ShaderObject_ShaderObject = R"doc()doc";
+static const char *__doc_sgl_ShaderObjectStats = R"doc()doc";
+
+static const char *__doc_sgl_ShaderObjectStats_skipped_size =
+R"doc(Number of bytes that were not uploaded because they were unchanged.)doc";
+
+static const char *__doc_sgl_ShaderObjectStats_skipped_write_count =
+R"doc(Number of ``set_data`` calls that were skipped entirely because the
+data was unchanged.)doc";
+
+static const char *__doc_sgl_ShaderObjectStats_write_count = R"doc(Number of ``set_data`` calls.)doc";
+
+static const char *__doc_sgl_ShaderObjectStats_write_size = R"doc(Number of bytes passed to ``set_data``.)doc";
+
+static const char *__doc_sgl_ShaderObject_ShaderObject =
+R"doc(Constructor.
+
+Parameter ``flat_layouts``:
+    Cache of flattened type layouts of the shader object's layout,
+    shared with sub-objects. A new cache is created if not provided.)doc";
 
 static const char *__doc_sgl_ShaderObject_class_name = R"doc()doc";
 
@@ -5822,6 +6842,9 @@ static const char *__doc_sgl_ShaderObject_device = R"doc()doc";
 
 static const char *__doc_sgl_ShaderObject_element_type_layout = R"doc()doc";
 
+static const char *__doc_sgl_ShaderObject_flat_layouts =
+R"doc(Cache of flattened type layouts used by shader cursors on this object.)doc";
+
 static const char *__doc_sgl_ShaderObject_get_cuda_interop_buffers = R"doc()doc";
 
 static const char *__doc_sgl_ShaderObject_get_entry_point = R"doc()doc";
@@ -5834,12 +6857,27 @@ static const char *__doc_sgl_ShaderObject_m_cuda_interop_buffers = R"doc()doc";
 
 static const char *__doc_sgl_ShaderObject_m_device = R"doc()doc";
 
+static const char *__doc_sgl_ShaderObject_m_flat_layouts = R"doc()doc";
+
 static const char *__doc_sgl_ShaderObject_m_objects = R"doc()doc";
 
 static const char *__doc_sgl_ShaderObject_m_retain = R"doc()doc";
 
 static const char *__doc_sgl_ShaderObject_m_shader_object = R"doc()doc";
 
+static const char *__doc_sgl_ShaderObject_m_shadow_copy_enabled = R"doc()doc";
+
+static const char *__doc_sgl_ShaderObject_m_shadow_data =
+R"doc(Uniform data last written to the shader object (shadow copy).)doc";
+
+static const char *__doc_sgl_ShaderObject_m_shadow_ranges =
+R"doc(Sorted, non-overlapping ranges [begin, end) of ``m_shadow_data`` that
+were written.)doc";
+
+static const char *__doc_sgl_ShaderObject_m_stats = R"doc()doc";
+
+static const char *__doc_sgl_ShaderObject_reset_stats = R"doc(Reset the statistics about uniform data writes.)doc";
+
 static const char *__doc_sgl_ShaderObject_rhi_shader_object = R"doc()doc";
 
 static const char *__doc_sgl_ShaderObject_set_acceleration_structure = R"doc()doc";
@@ -5848,6 +6886,10 @@ static const char *__doc_sgl_ShaderObject_set_buffer = R"doc()doc";
 
 static const char *__doc_sgl_ShaderObject_set_buffer_view = R"doc()doc";
 
+static const char *__doc_sgl_ShaderObject_set_cuda_interop_buffer =
+R"doc(Bind the buffer of a CUDA interop buffer and keep the interop buffer
+with this shader object.)doc";
+
 static const char *__doc_sgl_ShaderObject_set_cuda_tensor_view = R"doc()doc";
 
 static const char *__doc_sgl_ShaderObject_set_data = R"doc()doc";
@@ -5856,12 +6898,28 @@ static const char *__doc_sgl_ShaderObject_set_object = R"doc()doc";
 
 static const char *__doc_sgl_ShaderObject_set_sampler = R"doc()doc";
 
+static const char *__doc_sgl_ShaderObject_set_shadow_copy_enabled =
+R"doc(Enable or disable the shadow copy of the uniform data.
+
+With the shadow copy enabled, data passed to ``set_data`` is compared
+against the data that was last written to the same bytes. Only runs of
+changed bytes are uploaded (runs separated by less than 16 unchanged
+bytes are merged) and writes without any changes are skipped, so an
+object that is kept around and updated with the same values every
+frame is never modified. Bytes that were never written are always
+uploaded. Disabling the shadow copy releases it.)doc";
+
 static const char *__doc_sgl_ShaderObject_set_texture = R"doc()doc";
 
 static const char *__doc_sgl_ShaderObject_set_texture_view = R"doc()doc";
 
+static const char *__doc_sgl_ShaderObject_shadow_copy_enabled =
+R"doc(True if the shadow copy of the uniform data is enabled.)doc";
+
 static const char *__doc_sgl_ShaderObject_slang_element_type_layout = R"doc()doc";
 
+static const char *__doc_sgl_ShaderObject_stats = R"doc(Statistics about uniform data writes.)doc";
+
 static const char *__doc_sgl_ShaderOffset =
 R"doc(Represents the offset of a shader variable relative to its enclosing
 type/buffer/block.
@@ -5919,6 +6977,10 @@ static const char *__doc_sgl_ShaderProgram_class_name = R"doc()doc";
 
 static const char *__doc_sgl_ShaderProgram_desc = R"doc()doc";
 
+static const char *__doc_sgl_ShaderProgram_flat_layouts =
+R"doc(Cache of flattened type layouts of the linked program. Replaced when
+the program is rebuilt.)doc";
+
 static const char *__doc_sgl_ShaderProgram_layout = R"doc()doc";
 
 static const char *__doc_sgl_ShaderProgram_link =
@@ -5929,6 +6991,8 @@ static const char *__doc_sgl_ShaderProgram_m_data = R"doc()doc";
 
 static const char *__doc_sgl_ShaderProgram_m_desc = R"doc()doc";
 
+static const char *__doc_sgl_ShaderProgram_m_flat_layouts = R"doc()doc";
+
 static const char *__doc_sgl_ShaderProgram_m_registered_pipelines = R"doc()doc";
 
 static const char *__doc_sgl_ShaderProgram_m_session = R"doc()doc";
@@ -5985,6 +7049,84 @@ static const char *__doc_sgl_ShaderStage_ray_generation = R"doc()doc";
 
 static const char *__doc_sgl_ShaderStage_vertex = R"doc()doc";
 
+static const char *__doc_sgl_ShaderStructBinding =
+R"doc(Binds a C++ struct to a uniform struct variable of a shader.
+
+The fields of the C++ struct are described by ``ShaderStructTraits``.
+The first time the binding is written through a cursor of a given
+program, the variable is looked up by path and its layout is validated
+against the C++ struct: every slang field needs a C++ field with the
+same name, byte offset, size and type. After that, writing the struct
+is a single ``set_data`` call at the cached offset, without any name
+lookups or per-field type checks.
+
+The variable needs to be stored as uniform data in the shader object
+of the cursor, e.g. a global or entry point parameter. Variables
+behind a constant buffer or parameter block are not supported, use a
+cursor to the dereferenced block instead.
+
+A binding caches the layout it last resolved, so it is not
+thread-safe. Use a separate binding per thread when writing from
+multiple threads.)doc";
+
+static const char *__doc_sgl_ShaderStructBinding_ShaderStructBinding =
+R"doc(Constructor.
+
+Parameter ``path``:
+    Path to the variable relative to the cursor passed to ``write``.)doc";
+
+static const char *__doc_sgl_ShaderStructBinding_m_flat_layouts = R"doc()doc";
+
+static const char *__doc_sgl_ShaderStructBinding_m_offset = R"doc()doc";
+
+static const char *__doc_sgl_ShaderStructBinding_m_parent_layout = R"doc()doc";
+
+static const char *__doc_sgl_ShaderStructBinding_m_parent_offset = R"doc()doc";
+
+static const char *__doc_sgl_ShaderStructBinding_m_path = R"doc()doc";
+
+static const char *__doc_sgl_ShaderStructBinding_path = R"doc(Path to the variable.)doc";
+
+static const char *__doc_sgl_ShaderStructBinding_resolve =
+R"doc(Look up and validate the variable relative to ``cursor``, if not
+already done for its layout.)doc";
+
+static const char *__doc_sgl_ShaderStructBinding_write =
+R"doc(Write the struct to the variable relative to ``cursor``.)doc";
+
+static const char *__doc_sgl_ShaderStructField =
+R"doc(Description of a single field of a C++ struct mirroring a slang
+struct.)doc";
+
+static const char *__doc_sgl_ShaderStructField_cols =
+R"doc(Number of columns (matrices), number of elements (vectors) or 1.)doc";
+
+static const char *__doc_sgl_ShaderStructField_element_count =
+R"doc(Number of array elements, or 0 for non-array fields.)doc";
+
+static const char *__doc_sgl_ShaderStructField_element_kind =
+R"doc(Kind of the array elements (scalar, vector or matrix). Same as
+``kind`` for non-array fields.)doc";
+
+static const char *__doc_sgl_ShaderStructField_kind = R"doc(Kind of the field (scalar, vector, matrix or array).)doc";
+
+static const char *__doc_sgl_ShaderStructField_name = R"doc(Field name (must match the slang field name).)doc";
+
+static const char *__doc_sgl_ShaderStructField_offset = R"doc(Byte offset of the field in the C++ struct.)doc";
+
+static const char *__doc_sgl_ShaderStructField_rows = R"doc(Number of rows (matrices) or 1.)doc";
+
+static const char *__doc_sgl_ShaderStructField_scalar_type = R"doc(Scalar type of the field.)doc";
+
+static const char *__doc_sgl_ShaderStructField_size = R"doc(Size of the field in bytes.)doc";
+
+static const char *__doc_sgl_ShaderStructTraits =
+R"doc(Describes the fields of a C++ struct that mirrors a slang struct.
+
+Specialized using the ``SGL_SHADER_STRUCT_BEGIN``,
+``SGL_SHADER_STRUCT_FIELD`` and ``SGL_SHADER_STRUCT_END`` macros,
+which need to be used at global namespace scope.)doc";
+
 static const char *__doc_sgl_ShaderTable = R"doc()doc";
 
 static const char *__doc_sgl_ShaderTableDesc = R"doc()doc";
@@ -7115,6 +8257,25 @@ Parameter ``mip``:
 Returns:
     Subresource data.)doc";
 
+static const char *__doc_sgl_Texture_get_subresource_data_2 =
+R"doc(Get subresource data into caller provided host memory. \note This will
+wait until the data is copied back to host memory.
+
+Parameter ``layer``:
+    Layer index.
+
+Parameter ``mip``:
+    Mip level.
+
+Parameter ``data``:
+    Destination memory.
+
+Parameter ``size``:
+    Size of the destination memory in bytes.
+
+Parameter ``row_pitch``:
+    Destination row pitch in bytes (0 for tightly packed rows).)doc";
+
 static const char *__doc_sgl_Texture_get_subresource_layout =
 R"doc(Get layout of a texture subresource. By default, the row alignment
 used is that required by the target for direct buffer upload/download.
@@ -7152,6 +8313,19 @@ static const char *__doc_sgl_Texture_subresource_count = R"doc()doc";
 
 static const char *__doc_sgl_Texture_to_bitmap = R"doc()doc";
 
+static const char *__doc_sgl_Texture_to_bitmap_2 =
+R"doc(Read the texture into a preallocated bitmap. The bitmap must match the
+pixel format, component type and dimensions of the subresource.
+
+Parameter ``bitmap``:
+    Bitmap to write to.
+
+Parameter ``layer``:
+    Layer index.
+
+Parameter ``mip``:
+    Mip level.)doc";
+
 static const char *__doc_sgl_Texture_to_string = R"doc()doc";
 
 static const char *__doc_sgl_Texture_type = R"doc()doc";
@@ -7184,6 +8358,77 @@ static const char *__doc_sgl_Timer_now = R"doc(Current time point in nanoseconds
 
 static const char *__doc_sgl_Timer_reset = R"doc(Reset the timer.)doc";
 
+static const char *__doc_sgl_TransientResourcePool =
+R"doc(Pool of transient textures and buffers, keyed by their descriptor.
+
+Resources are acquired for the duration of a frame (or render graph
+pass) and released back to the pool once they are no longer recorded
+into. A released resource is recycled once the submission following
+its release has finished executing, so that steady-state frames do not
+create any resources. The pool holds a reference to acquired resources
+until they are released.)doc";
+
+static const char *__doc_sgl_TransientResourcePoolDesc = R"doc()doc";
+
+static const char *__doc_sgl_TransientResourcePoolDesc_enable_aliasing =
+R"doc(Allow reusing resources released within the current (not yet
+submitted) submission. This aliases resources with non-overlapping
+lifetimes in recording order, and is only safe if command buffers are
+submitted in the order they are recorded.)doc";
+
+static const char *__doc_sgl_TransientResourcePoolStats = R"doc()doc";
+
+static const char *__doc_sgl_TransientResourcePoolStats_created_count =
+R"doc(Number of resources created by the pool.)doc";
+
+static const char *__doc_sgl_TransientResourcePoolStats_free_count =
+R"doc(Number of resources currently available for recycling.)doc";
+
+static const char *__doc_sgl_TransientResourcePoolStats_in_use_count =
+R"doc(Number of resources currently acquired.)doc";
+
+static const char *__doc_sgl_TransientResourcePoolStats_reused_count =
+R"doc(Number of acquisitions served by recycling a resource.)doc";
+
+static const char *__doc_sgl_TransientResourcePool_TransientResourcePool = R"doc()doc";
+
+static const char *__doc_sgl_TransientResourcePool_acquire_buffer =
+R"doc(Acquire a buffer matching the given descriptor. The debug label is
+only applied to newly created buffers.
+
+Parameter ``desc``:
+    Buffer descriptor. Initial data is not supported.
+
+Returns:
+    Buffer object.)doc";
+
+static const char *__doc_sgl_TransientResourcePool_acquire_texture =
+R"doc(Acquire a texture matching the given descriptor. The debug label is
+only applied to newly created textures.
+
+Parameter ``desc``:
+    Texture descriptor. Initial data is not supported.
+
+Returns:
+    Texture object.)doc";
+
+static const char *__doc_sgl_TransientResourcePool_class_name = R"doc()doc";
+
+static const char *__doc_sgl_TransientResourcePool_desc = R"doc()doc";
+
+static const char *__doc_sgl_TransientResourcePool_release_buffer =
+R"doc(Release a buffer acquired from this pool.)doc";
+
+static const char *__doc_sgl_TransientResourcePool_release_texture =
+R"doc(Release a texture acquired from this pool.)doc";
+
+static const char *__doc_sgl_TransientResourcePool_stats = R"doc(Get pool statistics.)doc";
+
+static const char *__doc_sgl_TransientResourcePool_to_string = R"doc()doc";
+
+static const char *__doc_sgl_TransientResourcePool_trim =
+R"doc(Destroy all released resources whose last use has finished executing.)doc";
+
 static const char *__doc_sgl_TypeConformance =
 R"doc(Type conformance entry. Type conformances are used to narrow the set
 of types supported by a slang interface. They can be specified on an
@@ -7233,6 +8478,10 @@ static const char *__doc_sgl_TypeLayoutReflection_find_field_by_name = R"doc()do
 
 static const char *__doc_sgl_TypeLayoutReflection_find_field_index_by_name = R"doc()doc";
 
+static const char *__doc_sgl_TypeLayoutReflection_flat_layout =
+R"doc(Flattened layout of this type layout, built on first use and owned by
+this object.)doc";
+
 static const char *__doc_sgl_TypeLayoutReflection_from_slang = R"doc()doc";
 
 static const char *__doc_sgl_TypeLayoutReflection_get_field_binding_range_offset = R"doc()doc";
@@ -7245,6 +8494,10 @@ static const char *__doc_sgl_TypeLayoutReflection_is_array = R"doc()doc";
 
 static const char *__doc_sgl_TypeLayoutReflection_kind = R"doc()doc";
 
+static const char *__doc_sgl_TypeLayoutReflection_m_flat_layouts = R"doc()doc";
+
+static const char *__doc_sgl_TypeLayoutReflection_m_flat_layouts_once = R"doc()doc";
+
 static const char *__doc_sgl_TypeLayoutReflection_name = R"doc()doc";
 
 static const char *__doc_sgl_TypeLayoutReflection_parameter_category = R"doc()doc";
@@ -9269,7 +10522,9 @@ the Python reference counting functionality will simply not be used.
 
 Python binding code must invoke `object_init_py` and provide functions
 that can be used to increase/decrease the Python reference count of an
-instance (i.e., `Py_INCREF` / `Py_DECREF`).)doc";
+instance (i.e., `Py_INCREF` / `Py_DECREF`), and optionally functions
+to acquire and release the GIL (i.e., `PyGILState_Ensure` /
+`PyGILState_Release`).)doc";
 
 static const char *__doc_sgl_operator_band = R"doc()doc";
 
@@ -23,7 +23,9 @@ SGL_PY_DECLARE(core_thread);
 SGL_PY_DECLARE(core_timer);
 SGL_PY_DECLARE(core_window);
 
+SGL_PY_DECLARE(device_bindless);
 SGL_PY_DECLARE(device_buffer_cursor);
+SGL_PY_DECLARE(device_buffer_heap);
 SGL_PY_DECLARE(device_command);
 SGL_PY_DECLARE(device_coopvec);
 SGL_PY_DECLARE(device_device_resource);
@@ -33,6 +35,7 @@ SGL_PY_DECLARE(device_formats);
 SGL_PY_DECLARE(device_framebuffer);
 SGL_PY_DECLARE(device_input_layout);
 SGL_PY_DECLARE(device_kernel);
+SGL_PY_DECLARE(device_memory_tracker);
 SGL_PY_DECLARE(device_native_handle);
 SGL_PY_DECLARE(device_pipeline);
 SGL_PY_DECLARE(device_query);
@@ -44,6 +47,7 @@ SGL_PY_DECLARE(device_shader_cursor);
 SGL_PY_DECLARE(device_shader_object);
 SGL_PY_DECLARE(device_shader);
 SGL_PY_DECLARE(device_surface);
+SGL_PY_DECLARE(device_transient_resource_pool);
 SGL_PY_DECLARE(device_types);
 
 SGL_PY_DECLARE(math_scalar);
@@ -114,7 +118,10 @@ NB_MODULE(sgl_ext, m_)
     SGL_PY_IMPORT(device_types);
     SGL_PY_IMPORT(device_formats);
     SGL_PY_IMPORT(device_device_resource);
+    SGL_PY_IMPORT(device_memory_tracker);
     SGL_PY_IMPORT(device_resource);
+    SGL_PY_IMPORT(device_buffer_heap);
+    SGL_PY_IMPORT(device_transient_resource_pool);
     SGL_PY_IMPORT(device_sampler);
     SGL_PY_IMPORT(device_fence);
     SGL_PY_IMPORT(device_query);
@@ -126,6 +133,7 @@ NB_MODULE(sgl_ext, m_)
     SGL_PY_IMPORT(device_buffer_cursor);
     SGL_PY_IMPORT(device_shader_object);
     SGL_PY_IMPORT(device_shader_cursor);
+    SGL_PY_IMPORT(device_bindless);
     SGL_PY_IMPORT(device_surface);
     SGL_PY_IMPORT(device_command);
     SGL_PY_IMPORT(device_coopvec);
@@ -382,6 +382,7 @@ void Context::render(TextureView* texture_view, CommandEncoder* command_encoder)
             vertex_buffer = m_device->create_buffer({
                 .size = draw_data->TotalVtxCount * sizeof(ImDrawVert) + 128 * 1024,
                 .memory_type = MemoryType::upload,
+                .persistent_map = true,
                 .usage = BufferUsage::vertex_buffer,
                 .label = "imgui vertex buffer",
             });
@@ -392,12 +393,13 @@ void Context::render(TextureView* texture_view, CommandEncoder* command_encoder)
             index_buffer = m_device->create_buffer({
                 .size = draw_data->TotalIdxCount * sizeof(ImDrawIdx) + 1024,
                 .memory_type = MemoryType::upload,
+                .persistent_map = true,
                 .usage = BufferUsage::index_buffer,
                 .label = "imgui index buffer",
             });
         }
 
-        // Upload vertex & index data.
+        // Upload vertex & index data (buffers are persistently mapped).
         ImDrawVert* vertices = vertex_buffer->map<ImDrawVert>();
         ImDrawIdx* indices = index_buffer->map<ImDrawIdx>();
         for (int i = 0; i < draw_data->CmdListsCount; ++i) {
@@ -407,8 +409,6 @@ void Context::render(TextureView* texture_view, CommandEncoder* command_encoder)
             vertices += cmd_list->VtxBuffer.Size;
             indices += cmd_list->IdxBuffer.Size;
         }
-        vertex_buffer->unmap();
-        index_buffer->unmap();
 
         // Render command lists.
         auto pass_encoder = command_encoder->begin_render_pass({
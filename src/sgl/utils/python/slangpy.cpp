@@ -6,6 +6,7 @@
 
 #include "sgl/core/macros.h"
 #include "sgl/core/logger.h"
+#include "sgl/core/maths.h"
 #include "sgl/utils/slangpy.h"
 #include "sgl/device/device.h"
 #include "sgl/device/kernel.h"
@@ -250,6 +251,22 @@ nb::object NativeBoundVariableRuntime::read_output(CallContext* context, nb::obj
     }
 }
 
+size_t NativeBoundVariableRuntime::calculate_element_size() const
+{
+    if (m_children) {
+        size_t size = 0;
+        for (const auto& [name, child_ref] : *m_children) {
+            if (child_ref)
+                size += child_ref->calculate_element_size();
+        }
+        return size;
+    }
+    if (!m_vector_type)
+        return 0;
+    ref<TypeLayoutReflection> layout = m_vector_type->buffer_type_layout();
+    return layout ? layout->size() : 0;
+}
+
 Shape NativeBoundCallRuntime::calculate_call_shape(
     int call_dimensionality,
     nb::list args,
@@ -277,6 +294,16 @@ Shape NativeBoundCallRuntime::calculate_call_shape(
     return Shape(call_shape);
 }
 
+size_t NativeBoundCallRuntime::calculate_element_size() const
+{
+    size_t size = 0;
+    for (const auto& arg : m_args)
+        size += arg->calculate_element_size();
+    for (const auto& [name, kwarg] : m_kwargs)
+        size += kwarg->calculate_element_size();
+    return size;
+}
+
 void NativeBoundCallRuntime::write_shader_cursor_pre_dispatch(
     CallContext* context,
     ShaderCursor cursor,
@@ -338,6 +365,11 @@ nb::object NativeCallData::call(ref<NativeCallRuntimeOptions> opts, nb::args arg
     return exec(opts, nullptr, args, kwargs);
 }
 
+nb::object NativeCallData::call_async(ref<NativeCallRuntimeOptions> opts, nb::args args, nb::kwargs kwargs)
+{
+    return exec(opts, nullptr, args, kwargs, true);
+}
+
 nb::object NativeCallData::append_to(
     ref<NativeCallRuntimeOptions> opts,
     CommandEncoder* command_encoder,
@@ -352,7 +384,8 @@ nb::object NativeCallData::exec(
     ref<NativeCallRuntimeOptions> opts,
     CommandEncoder* command_encoder,
     nb::args args,
-    nb::kwargs kwargs
+    nb::kwargs kwargs,
+    bool async_call
 )
 {
     // Unpack args and kwargs.
@@ -389,6 +422,13 @@ nb::object NativeCallData::exec(
 
     nb::list read_back;
 
+    // Select the kernel to dispatch, which may be specialized for the call shape.
+    ref<ComputeKernel> kernel = get_kernel_for_call_shape(call_shape);
+    bool is_specialized = kernel != m_kernel;
+
+    // Number of elements processed per thread (see calc_elements_per_thread).
+    uint32_t elements_per_thread = 1;
+
     // Dispatch the kernel.
     auto bind_vars = [&](ShaderCursor cursor)
     {
@@ -401,11 +441,42 @@ nb::object NativeCallData::exec(
         if (call_data_cursor.is_reference())
             call_data_cursor = call_data_cursor.dereference();
 
+        // Kernels specialized for the call shape class bake the strides and inner
+        // dimensions in as link time constants, in which case the fields may not be
+        // present. The generic kernel always declares them.
+        auto call_shape_field = [&](std::string_view name)
+        { return is_specialized ? call_data_cursor.find_field(name) : call_data_cursor[name]; };
         if (!strides.empty()) {
-            call_data_cursor["_call_stride"]._set_array_unsafe(&strides[0], strides.size() * 4, strides.size());
-            call_data_cursor["_call_dim"]._set_array_unsafe(&cs[0], cs.size() * 4, cs.size());
+            ShaderCursor call_stride_cursor = call_shape_field("_call_stride");
+            if (call_stride_cursor.is_valid())
+                call_stride_cursor._set_array_unsafe(&strides[0], strides.size() * 4, strides.size());
+            ShaderCursor call_dim_cursor = call_shape_field("_call_dim");
+            if (call_dim_cursor.is_valid())
+                call_dim_cursor._set_array_unsafe(&cs[0], cs.size() * 4, cs.size());
+        }
+        ShaderCursor thread_count_cursor = call_shape_field("_thread_count");
+        if (thread_count_cursor.is_valid())
+            thread_count_cursor = uint3(total_threads, 1, 1);
+
+        // Kernels generated with work coarsening support loop over _elements_per_thread
+        // elements per thread, so fewer threads need dispatching (see set_max_elements_per_thread).
+        ShaderCursor elements_per_thread_cursor = call_data_cursor.find_field("_elements_per_thread");
+        if (elements_per_thread_cursor.is_valid()) {
+            // Deriving the element size calls into Python, so it is only done once.
+            size_t element_size = m_coarsening_element_size;
+            if (element_size == 0) {
+                if (!m_derived_element_size)
+                    m_derived_element_size = m_runtime->calculate_element_size();
+                element_size = *m_derived_element_size;
+            }
+            elements_per_thread = calc_elements_per_thread(
+                total_threads,
+                element_size,
+                kernel->thread_group_size().x,
+                m_max_elements_per_thread
+            );
+            elements_per_thread_cursor = elements_per_thread;
         }
-        call_data_cursor["_thread_count"] = uint3(total_threads, 1, 1);
 
         m_runtime
             ->write_shader_cursor_pre_dispatch(context, call_data_cursor, unpacked_args, unpacked_kwargs, read_back);
@@ -431,21 +502,122 @@ nb::object NativeCallData::exec(
         log_debug("  Threads: {}", total_threads);
     }
 
-    m_kernel->dispatch(uint3(total_threads, 1, 1), bind_vars, command_encoder);
+    // Create a temporary encoder if not appending to an existing one.
+    ref<CommandEncoder> temp_command_encoder;
+    if (command_encoder == nullptr) {
+        temp_command_encoder = m_device->create_command_encoder();
+        command_encoder = temp_command_encoder;
+    }
+
+    // Writing the call data touches Python objects so must happen with the GIL held.
+    ref<ComputePassEncoder> pass_encoder = command_encoder->begin_compute_pass();
+    ShaderObject* shader_object = pass_encoder->bind_pipeline(kernel->pipeline());
+    bind_vars(ShaderCursor(shader_object));
+
+    // Encoding the dispatch and submitting it is pure native work, so release the GIL
+    // to allow other Python threads to run (and dispatch) concurrently.
+    uint64_t submit_id = 0;
+    {
+        nb::gil_scoped_release guard;
+        pass_encoder->dispatch(uint3(div_round_up(uint32_t(total_threads), elements_per_thread), 1, 1));
+        pass_encoder->end();
+        if (temp_command_encoder)
+            submit_id = m_device->submit_command_buffer(temp_command_encoder->finish());
+    }
+    pass_encoder = nullptr;
 
     // If command_buffer is not null, return early.
-    if (command_encoder != nullptr) {
+    if (!temp_command_encoder) {
         return nanobind::none();
     }
 
+    // For async calls, defer read back until the result is requested.
+    if (async_call) {
+        return nb::cast(make_ref<NativeCallFuture>(
+            ref(this),
+            context,
+            submit_id,
+            read_back,
+            args,
+            kwargs,
+            unpacked_args,
+            unpacked_kwargs
+        ));
+    }
+
+    return finalize_call(context, read_back, args, kwargs, unpacked_args, unpacked_kwargs);
+}
+
+std::string NativeCallData::call_shape_link_constants(const Shape& call_shape)
+{
+    // Generate link time constants for the strides and all but the outermost call dimension.
+    // None of these depend on the outermost dimension, so a kernel specialized with them can
+    // be shared by all call shapes of the same class (e.g. batches of different sizes).
+    const std::vector<int>& cs = call_shape.as_vector();
+    std::string res;
+    int stride = 1;
+    for (size_t i = cs.size(); i-- > 0;) {
+        if (i > 0)
+            res += fmt::format("export static const int _call_dim_{} = {};\n", i, cs[i]);
+        res += fmt::format("export static const int _call_stride_{} = {};\n", i, stride);
+        stride *= cs[i];
+    }
+    return res;
+}
+
+ref<ComputeKernel> NativeCallData::get_kernel_for_call_shape(const Shape& call_shape)
+{
+    if (!m_kernel_specializer.is_valid() || m_kernel_specializer.is_none())
+        return m_kernel;
+
+    // Kernels are specialized per call shape class, which is the call shape without its
+    // outermost dimension (see call_shape_link_constants).
+    const std::vector<int>& cs = call_shape.as_vector();
+    std::vector<int> key(cs.empty() ? cs.begin() : cs.begin() + 1, cs.end());
+    auto it = m_specialized_kernels.find(key);
+    if (it != m_specialized_kernels.end())
+        return it->second;
+
+    // Limit the number of specializations to avoid compiling a kernel for every
+    // call shape when shapes vary a lot. Beyond the limit the generic kernel is used.
+    if (m_specialized_kernels.size() >= m_max_kernel_specializations) {
+        m_kernel_specialization_fallback_count++;
+        log(
+            LogLevel::warn,
+            fmt::format(
+                "{}: reached the limit of {} kernel specializations, falling back to the generic kernel.",
+                m_debug_name,
+                m_max_kernel_specializations
+            ),
+            LogFrequency::once
+        );
+        return m_kernel;
+    }
+
+    ref<ComputeKernel> kernel = nb::cast<ref<ComputeKernel>>(
+        m_kernel_specializer(call_shape, call_shape_link_constants(call_shape))
+    );
+    if (!kernel)
+        kernel = m_kernel;
+    m_specialized_kernels[std::move(key)] = kernel;
+    return kernel;
+}
+
+nb::object NativeCallData::finalize_call(
+    CallContext* context,
+    nb::list read_back,
+    nb::tuple args,
+    nb::dict kwargs,
+    nb::list unpacked_args,
+    nb::dict unpacked_kwargs
+)
+{
     // Read call data post dispatch.
-    // m_runtime->read_call_data_post_dispatch(context, call_data, unpacked_args, unpacked_kwargs);
+    // Entries are (binding, value, data) tuples, which Python marshalls may also append.
     for (auto val : read_back) {
         auto t = nb::cast<nb::tuple>(val);
-        auto bvr = nb::cast<ref<NativeBoundVariableRuntime>>(t[0]);
-        auto rb_val = t[1];
-        auto rb_data = t[2];
-        bvr->get_python_type()->read_calldata(context, bvr.get(), rb_val, rb_data);
+        auto bvr = nb::cast<NativeBoundVariableRuntime*>(t[0]);
+        bvr->get_python_type()->read_calldata(context, bvr, t[1], t[2]);
     }
 
     // Pack updated 'this' values back.
@@ -466,6 +638,87 @@ nb::object NativeCallData::exec(
     return nb::none();
 }
 
+NativeCallFuture::NativeCallFuture(
+    ref<NativeCallData> call_data,
+    ref<CallContext> context,
+    uint64_t submit_id,
+    nb::list read_back,
+    nb::tuple args,
+    nb::dict kwargs,
+    nb::list unpacked_args,
+    nb::dict unpacked_kwargs
+)
+    : m_call_data(std::move(call_data))
+    , m_context(std::move(context))
+    , m_submit_id(submit_id)
+    , m_read_back(std::move(read_back))
+    , m_args(std::move(args))
+    , m_kwargs(std::move(kwargs))
+    , m_unpacked_args(std::move(unpacked_args))
+    , m_unpacked_kwargs(std::move(unpacked_kwargs))
+{
+}
+
+bool NativeCallFuture::done() const
+{
+    return m_resolved || m_context->device()->is_submit_finished(m_submit_id);
+}
+
+void NativeCallFuture::wait() const
+{
+    if (m_resolved)
+        return;
+    nb::gil_scoped_release guard;
+    m_context->device()->wait_for_submit(m_submit_id);
+}
+
+nb::object NativeCallFuture::result()
+{
+    if (!m_resolved) {
+        wait();
+        resolve();
+    }
+    return m_result;
+}
+
+void NativeCallFuture::resolve()
+{
+    m_result
+        = m_call_data->finalize_call(m_context, m_read_back, m_args, m_kwargs, m_unpacked_args, m_unpacked_kwargs);
+    m_resolved = true;
+
+    // Release references to call arguments as soon as they are no longer needed.
+    m_read_back = nb::list();
+    m_args = nb::tuple();
+    m_kwargs = nb::dict();
+    m_unpacked_args = nb::list();
+    m_unpacked_kwargs = nb::dict();
+}
+
+nb::list NativeCallFuture::wait_all(const std::vector<ref<NativeCallFuture>>& futures)
+{
+    // Wait for every submission before reading back, so no read back blocks on the device.
+    // Read back is implemented by the (python) marshalls of each call, so it is still
+    // performed per future rather than as a single copy.
+    for (const auto& future : futures)
+        SGL_CHECK_NOT_NULL(future);
+    {
+        nb::gil_scoped_release guard;
+        for (const auto& future : futures) {
+            if (!future->m_resolved)
+                future->m_context->device()->wait_for_submit(future->m_submit_id);
+        }
+    }
+
+    nb::list results;
+    for (const auto& future : futures) {
+        if (!future->m_resolved)
+            future->resolve();
+        results.append(future->m_result);
+    }
+    return results;
+}
+
 NativeCallDataCache::NativeCallDataCache()
 {
     m_cache.reserve(1024);
@@ -1012,6 +1265,47 @@ SGL_PY_EXPORT(utils_slangpy)
             D_NA(NativeCallData, call_mode)
         )
         .def_prop_ro("last_call_shape", &NativeCallData::get_last_call_shape, D_NA(NativeCallData, last_call_shape))
+        .def_prop_rw(
+            "kernel_specializer",
+            &NativeCallData::get_kernel_specializer,
+            &NativeCallData::set_kernel_specializer,
+            nb::arg().none(),
+            D_NA(NativeCallData, kernel_specializer)
+        )
+        .def_prop_rw(
+            "max_kernel_specializations",
+            &NativeCallData::get_max_kernel_specializations,
+            &NativeCallData::set_max_kernel_specializations,
+            D_NA(NativeCallData, max_kernel_specializations)
+        )
+        .def_prop_rw(
+            "max_elements_per_thread",
+            &NativeCallData::get_max_elements_per_thread,
+            &NativeCallData::set_max_elements_per_thread,
+            D_NA(NativeCallData, max_elements_per_thread)
+        )
+        .def_prop_rw(
+            "coarsening_element_size",
+            &NativeCallData::get_coarsening_element_size,
+            &NativeCallData::set_coarsening_element_size,
+            D_NA(NativeCallData, coarsening_element_size)
+        )
+        .def_prop_ro(
+            "kernel_specialization_count",
+            &NativeCallData::get_kernel_specialization_count,
+            D_NA(NativeCallData, kernel_specialization_count)
+        )
+        .def_prop_ro(
+            "kernel_specialization_fallback_count",
+            &NativeCallData::get_kernel_specialization_fallback_count,
+            D_NA(NativeCallData, kernel_specialization_fallback_count)
+        )
+        .def_static(
+            "call_shape_link_constants",
+            &NativeCallData::call_shape_link_constants,
+            "call_shape"_a,
+            D_NA(NativeCallData, call_shape_link_constants)
+        )
         .def_prop_rw(
             "debug_name",
             &NativeCallData::get_debug_name,
@@ -1033,6 +1327,14 @@ SGL_PY_EXPORT(utils_slangpy)
             nb::arg("kwargs"),
             D_NA(NativeCallData, call)
         )
+        .def(
+            "call_async",
+            &NativeCallData::call_async,
+            nb::arg("opts"),
+            nb::arg("args"),
+            nb::arg("kwargs"),
+            D_NA(NativeCallData, call_async)
+        )
         .def(
             "append_to",
             &NativeCallData::append_to,
@@ -1051,6 +1353,13 @@ SGL_PY_EXPORT(utils_slangpy)
 
 #undef DEF_LOG_METHOD
 
+    nb::class_<NativeCallFuture, Object>(slangpy, "NativeCallFuture") //
+        .def_prop_ro("submit_id", &NativeCallFuture::submit_id, D_NA(NativeCallFuture, submit_id))
+        .def("done", &NativeCallFuture::done, D_NA(NativeCallFuture, done))
+        .def("wait", &NativeCallFuture::wait, D_NA(NativeCallFuture, wait))
+        .def("result", &NativeCallFuture::result, D_NA(NativeCallFuture, result))
+        .def_static("wait_all", &NativeCallFuture::wait_all, "futures"_a, D_NA(NativeCallFuture, wait_all));
+
     nb::class_<NativeCallDataCache, PyNativeCallDataCache, Object>(slangpy, "NativeCallDataCache")
         .def(
             "__init__",
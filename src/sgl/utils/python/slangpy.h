@@ -11,6 +11,7 @@
 
 #include "sgl/core/macros.h"
 #include "sgl/core/fwd.h"
+#include "sgl/core/hash.h"
 #include "sgl/core/object.h"
 #include "sgl/device/fwd.h"
 #include "sgl/device/shader_cursor.h"
@@ -334,6 +335,7 @@ public:
 
 
 protected:
+    /// Store a value for read back after dispatch as a (binding, value, data) tuple.
     void
     store_readback(NativeBoundVariableRuntime* binding, nb::list& read_back, nb::object value, nb::object data) const;
 
@@ -480,6 +482,9 @@ public:
     /// Write uniforms for raw dispatch.
     void write_raw_dispatch_data(nb::dict call_data, nb::object value);
 
+    /// Recursively sum the buffer layout size of the per thread element types (call into Python).
+    size_t calculate_element_size() const;
+
 private:
     std::pair<AccessType, AccessType> m_access{AccessType::none, AccessType::none};
     Shape m_transform;
@@ -537,6 +542,9 @@ public:
     /// Write uniforms for raw dispatch.
     void write_raw_dispatch_data(nb::dict call_data, nb::dict kwargs);
 
+    /// Calculate the number of bytes of element data each thread processes, summed over all arguments.
+    size_t calculate_element_size() const;
+
 private:
     std::vector<ref<NativeBoundVariableRuntime>> m_args;
     std::map<std::string, ref<NativeBoundVariableRuntime>> m_kwargs;
@@ -592,7 +600,11 @@ public:
     ref<ComputeKernel> get_kernel() const { return m_kernel; }
 
     /// Set the compute kernel.
-    void set_kernel(const ref<ComputeKernel>& kernel) { m_kernel = kernel; }
+    void set_kernel(const ref<ComputeKernel>& kernel)
+    {
+        m_kernel = kernel;
+        m_specialized_kernels.clear();
+    }
 
     /// Get the call dimensionality.
     int get_call_dimensionality() const { return m_call_dimensionality; }
@@ -604,7 +616,11 @@ public:
     ref<NativeBoundCallRuntime> get_runtime() const { return m_runtime; }
 
     /// Set the runtime bindings.
-    void set_runtime(const ref<NativeBoundCallRuntime>& runtime) { m_runtime = runtime; }
+    void set_runtime(const ref<NativeBoundCallRuntime>& runtime)
+    {
+        m_runtime = runtime;
+        m_derived_element_size.reset();
+    }
 
     /// Get the call mode (primitive/forward/backward).
     CallMode get_call_mode() const { return m_call_mode; }
@@ -615,6 +631,56 @@ public:
     /// Get the shape of the last call (useful for debugging).
     const Shape& get_last_call_shape() const { return m_last_call_shape; }
 
+    /// Get the kernel specializer.
+    nb::object get_kernel_specializer() const { return m_kernel_specializer; }
+
+    /// Set the kernel specializer. This is a callable taking (call_shape, link_constants)
+    /// and returning a ComputeKernel compiled with the provided link time constants
+    /// (see call_shape_link_constants). The kernel is cached per call shape class, i.e.
+    /// it is used for all call shapes that only differ in their outermost dimension.
+    void set_kernel_specializer(nb::object specializer)
+    {
+        m_kernel_specializer = std::move(specializer);
+        m_specialized_kernels.clear();
+        m_kernel_specialization_fallback_count = 0;
+    }
+
+    /// Get the maximum number of call shape specialized kernels.
+    size_t get_max_kernel_specializations() const { return m_max_kernel_specializations; }
+
+    /// Set the maximum number of call shape specialized kernels. Calls with a shape class
+    /// beyond the limit use the generic kernel and log a warning.
+    void set_max_kernel_specializations(size_t count) { m_max_kernel_specializations = count; }
+
+    /// Get the number of call shape specialized kernels currently cached.
+    size_t get_kernel_specialization_count() const { return m_specialized_kernels.size(); }
+
+    /// Get the number of calls that used the generic kernel because the specialization limit was reached.
+    size_t get_kernel_specialization_fallback_count() const { return m_kernel_specialization_fallback_count; }
+
+    /// Generate slang source declaring the call shape class as link time constants
+    /// (_call_stride_N for all dimensions and _call_dim_N for all but the outermost one).
+    /// The outermost dimension and _thread_count still need to be read from the call data.
+    static std::string call_shape_link_constants(const Shape& call_shape);
+
+    /// Get the maximum number of elements each thread may process (1 disables work coarsening).
+    uint32_t get_max_elements_per_thread() const { return m_max_elements_per_thread; }
+
+    /// Set the maximum number of elements each thread may process. Only used by kernels
+    /// generated with a _elements_per_thread call data field. Such kernels are dispatched
+    /// with N = ceil(_thread_count / _elements_per_thread) threads, and thread t processes
+    /// elements t + k * N for k < _elements_per_thread, so neighbouring threads still
+    /// access neighbouring elements.
+    void set_max_elements_per_thread(uint32_t count) { m_max_elements_per_thread = count; }
+
+    /// Get the element size (in bytes) used to choose the work coarsening factor.
+    /// 0 means the size is derived from the element types of the bound arguments.
+    size_t get_coarsening_element_size() const { return m_coarsening_element_size; }
+
+    /// Set the element size (in bytes) used to choose the work coarsening factor.
+    /// 0 derives the size from the element types of the bound arguments.
+    void set_coarsening_element_size(size_t size) { m_coarsening_element_size = size; }
+
     /// Get the debug name
     std::string get_debug_name() const { return m_debug_name; }
 
@@ -630,6 +696,11 @@ public:
     /// Call the compute kernel with the provided arguments and keyword arguments.
     nb::object call(ref<NativeCallRuntimeOptions> opts, nb::args args, nb::kwargs kwargs);
 
+    /// Call the compute kernel with the provided arguments and keyword arguments, without
+    /// waiting for it to complete. Returns a NativeCallFuture that performs any read back
+    /// and returns the call result once the submission has finished.
+    nb::object call_async(ref<NativeCallRuntimeOptions> opts, nb::args args, nb::kwargs kwargs);
+
     /// Append the compute kernel to a command encoder with the provided arguments and keyword arguments.
     nb::object
     append_to(ref<NativeCallRuntimeOptions> opts, CommandEncoder* command_encoder, nb::args args, nb::kwargs kwargs);
@@ -671,12 +742,101 @@ private:
     Shape m_last_call_shape;
     std::string m_debug_name;
     ref<Logger> m_logger;
+    nb::object m_kernel_specializer;
+    size_t m_max_kernel_specializations{16};
+    size_t m_kernel_specialization_fallback_count{0};
+    uint32_t m_max_elements_per_thread{8};
+    size_t m_coarsening_element_size{0};
+    std::optional<size_t> m_derived_element_size;
+
+    /// Hashes call shape classes, so specialized kernels can be looked up without formatting the shape.
+    struct CallShapeHasher {
+        size_t operator()(const std::vector<int>& shape) const
+        {
+            size_t result = 0;
+            for (int dim : shape)
+                result = hash_combine(result, std::hash<int>{}(dim));
+            return result;
+        }
+    };
+    /// Specialized kernels keyed by call shape class (all but the outermost dimension).
+    std::unordered_map<std::vector<int>, ref<ComputeKernel>, CallShapeHasher> m_specialized_kernels;
+
+    /// Get the kernel to use for a given call shape, specializing it if a kernel specializer is set.
+    ref<ComputeKernel> get_kernel_for_call_shape(const Shape& call_shape);
+
+    nb::object exec(
+        ref<NativeCallRuntimeOptions> opts,
+        CommandEncoder* command_encoder,
+        nb::args args,
+        nb::kwargs kwargs,
+        bool async_call = false
+    );
 
-    nb::object
-    exec(ref<NativeCallRuntimeOptions> opts, CommandEncoder* command_encoder, nb::args args, nb::kwargs kwargs);
+    /// Read back call data, pack updated arguments and read the return value after dispatch.
+    nb::object finalize_call(
+        CallContext* context,
+        nb::list read_back,
+        nb::tuple args,
+        nb::dict kwargs,
+        nb::list unpacked_args,
+        nb::dict unpacked_kwargs
+    );
+
+    friend class NativeCallFuture;
 };
 #undef SGL_LOG_FUNC_FAMILY
 
+/// Result of an asynchronous call (see NativeCallData::call_async). Holds on to the call
+/// arguments and read back list until the submission has finished, at which point read
+/// back is performed and the result returned.
+class NativeCallFuture : public Object {
+public:
+    NativeCallFuture(
+        ref<NativeCallData> call_data,
+        ref<CallContext> context,
+        uint64_t submit_id,
+        nb::list read_back,
+        nb::tuple args,
+        nb::dict kwargs,
+        nb::list unpacked_args,
+        nb::dict unpacked_kwargs
+    );
+
+    /// Submission ID of the dispatch.
+    uint64_t submit_id() const { return m_submit_id; }
+
+    /// True if the dispatch has finished executing on the device.
+    bool done() const;
+
+    /// Wait for the dispatch to finish executing (releases the GIL while waiting).
+    void wait() const;
+
+    /// Wait for the dispatch to finish, perform read back and return the call result.
+    /// The result is cached, so subsequent calls return the same object.
+    nb::object result();
+
+    /// Wait for all submissions of a list of futures, then read back all of them.
+    /// Returns the list of results.
+    /// Read back goes through the marshalls of each call, so every future still
+    /// performs its own read back copies (they are not coalesced into one copy).
+    static nb::list wait_all(const std::vector<ref<NativeCallFuture>>& futures);
+
+private:
+    void resolve();
+
+    ref<NativeCallData> m_call_data;
+    ref<CallContext> m_context;
+    uint64_t m_submit_id;
+    nb::list m_read_back;
+    nb::tuple m_args;
+    nb::dict m_kwargs;
+    nb::list m_unpacked_args;
+    nb::dict m_unpacked_kwargs;
+    bool m_resolved{false};
+    nb::object m_result;
+};
+
 typedef std::function<bool(const ref<SignatureBuilder>& builder, nb::handle)> BuildSignatureFunc;
 
 /// Native side of system for caching call data info for given function signatures.
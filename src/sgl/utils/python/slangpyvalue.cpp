@@ -10,6 +10,107 @@ extern void write_shader_cursor(ShaderCursor& cursor, nb::object value);
 
 namespace sgl::slangpy {
 
+namespace {
+
+    /// Write a bound sgl vector type directly if the Python object is exactly that type.
+    template<typename T>
+    bool try_write_vector(ShaderCursor& field, nb::handle value, const std::type_info& ti)
+    {
+        if (ti != typeid(T))
+            return false;
+        field.set(*nb::inst_ptr<T>(value));
+        return true;
+    }
+
+    /// Attempt to write a Python value to a scalar/vector field without going through the
+    /// generic converter table. Handles Python bool/int/float and the sgl vector types, which
+    /// covers the vast majority of values passed to slangpy functions. Returns false if the
+    /// value needs the generic path.
+    bool try_write_value_fast(ShaderCursor& field, nb::handle value)
+    {
+        slang::TypeLayoutReflection* type_layout = field.slang_type_layout();
+        if (!type_layout)
+            return false;
+        slang::TypeReflection* type = type_layout->getType();
+        if (!type)
+            return false;
+
+        auto kind = (TypeReflection::Kind)type_layout->getKind();
+        auto scalar_type = (TypeReflection::ScalarType)type->getScalarType();
+        PyObject* obj = value.ptr();
+
+        if (kind == TypeReflection::Kind::scalar) {
+            if (PyBool_Check(obj)) {
+                if (scalar_type != TypeReflection::ScalarType::bool_)
+                    return false;
+                field.set(obj == Py_True);
+                return true;
+            }
+            if (PyFloat_CheckExact(obj)) {
+                double v = PyFloat_AS_DOUBLE(obj);
+                switch (scalar_type) {
+                case TypeReflection::ScalarType::float32:
+                    field.set(float(v));
+                    return true;
+                case TypeReflection::ScalarType::float64:
+                    field.set(v);
+                    return true;
+                case TypeReflection::ScalarType::float16:
+                    field.set(float16_t(float(v)));
+                    return true;
+                default:
+                    return false;
+                }
+            }
+            if (PyLong_CheckExact(obj)) {
+                switch (scalar_type) {
+                case TypeReflection::ScalarType::int32:
+                    field.set(nb::cast<int32_t>(value));
+                    return true;
+                case TypeReflection::ScalarType::uint32:
+                    field.set(nb::cast<uint32_t>(value));
+                    return true;
+                case TypeReflection::ScalarType::int64:
+                    field.set(nb::cast<int64_t>(value));
+                    return true;
+                case TypeReflection::ScalarType::uint64:
+                    field.set(nb::cast<uint64_t>(value));
+                    return true;
+                case TypeReflection::ScalarType::float32:
+                    field.set(nb::cast<float>(value));
+                    return true;
+                default:
+                    return false;
+                }
+            }
+            return false;
+        }
+
+        if (kind == TypeReflection::Kind::vector) {
+            nb::handle py_type = value.type();
+            if (!nb::type_check(py_type))
+                return false;
+            const std::type_info& ti = nb::type_info(py_type);
+            switch (scalar_type) {
+            case TypeReflection::ScalarType::float32:
+                return try_write_vector<float2>(field, value, ti) || try_write_vector<float3>(field, value, ti)
+                    || try_write_vector<float4>(field, value, ti);
+            case TypeReflection::ScalarType::int32:
+                return try_write_vector<int2>(field, value, ti) || try_write_vector<int3>(field, value, ti)
+                    || try_write_vector<int4>(field, value, ti);
+            case TypeReflection::ScalarType::uint32:
+                return try_write_vector<uint2>(field, value, ti) || try_write_vector<uint3>(field, value, ti)
+                    || try_write_vector<uint4>(field, value, ti);
+            default:
+                return false;
+            }
+        }
+
+        return false;
+    }
+
+} // namespace
+
 void NativeValueMarshall::write_shader_cursor_pre_dispatch(
     CallContext* context,
     NativeBoundVariableRuntime* binding,
@@ -23,7 +124,8 @@ void NativeValueMarshall::write_shader_cursor_pre_dispatch(
         SGL_UNUSED(binding);
         SGL_UNUSED(context);
         ShaderCursor field = cursor[binding->get_variable_name()]["value"];
-        write_shader_cursor(field, value);
+        if (!try_write_value_fast(field, value))
+            write_shader_cursor(field, value);
     }
 }
 
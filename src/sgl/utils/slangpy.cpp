@@ -3,6 +3,37 @@
 #include "slangpy.h"
 #include "sgl/device/device.h"
 
+#include <algorithm>
+
 namespace sgl::slangpy {
 
+uint32_t calc_elements_per_thread(
+    uint32_t total_threads,
+    size_t element_size,
+    uint32_t thread_group_size,
+    uint32_t max_elements_per_thread
+)
+{
+    // Aim for roughly this many bytes of element data per thread.
+    constexpr size_t TARGET_BYTES_PER_THREAD = 64;
+    // Never coarsen below this many thread groups.
+    constexpr uint32_t MIN_THREAD_GROUPS = 1024;
+
+    if (max_elements_per_thread <= 1 || thread_group_size == 0)
+        return 1;
+
+    uint32_t count = max_elements_per_thread;
+    if (element_size > 0)
+        count = std::min(count, uint32_t(std::max(size_t(1), TARGET_BYTES_PER_THREAD / element_size)));
+
+    uint64_t min_threads = uint64_t(thread_group_size) * MIN_THREAD_GROUPS;
+    count = std::min(count, uint32_t(std::max(uint64_t(1), total_threads / min_threads)));
+
+    // Round down to a power of two.
+    uint32_t result = 1;
+    while (result * 2 <= count)
+        result *= 2;
+    return result;
+}
+
 } // namespace sgl::slangpy
@@ -167,6 +167,18 @@ private:
     std::optional<std::vector<int>> m_shape;
 };
 
+/// Choose the number of elements each thread processes for a call of \c total_threads
+/// elements, for kernels that support work coarsening. Small elements are coarsened
+/// more (to amortize per thread overhead), but the result never drops the dispatch
+/// below a minimum number of thread groups, so large GPUs remain fully occupied.
+/// Always returns a power of two in the range [1, max_elements_per_thread].
+SGL_API uint32_t calc_elements_per_thread(
+    uint32_t total_threads,
+    size_t element_size,
+    uint32_t thread_group_size,
+    uint32_t max_elements_per_thread
+);
+
 class SGL_API CallContext : Object {
 public:
     CallContext(ref<Device> device, const Shape& call_shape, CallMode call_mode)
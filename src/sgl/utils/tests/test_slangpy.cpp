@@ -0,0 +1,51 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "testing.h"
+#include "sgl/utils/slangpy.h"
+
+using namespace sgl;
+using namespace sgl::slangpy;
+
+TEST_SUITE_BEGIN("slangpy");
+
+TEST_CASE("calc_elements_per_thread")
+{
+    // Large enough that the minimum thread group count never limits coarsening.
+    const uint32_t large = 1u << 30;
+
+    SUBCASE("disabled")
+    {
+        CHECK_EQ(calc_elements_per_thread(large, 4, 32, 1), 1u);
+        CHECK_EQ(calc_elements_per_thread(large, 4, 32, 0), 1u);
+        CHECK_EQ(calc_elements_per_thread(large, 4, 0, 16), 1u);
+    }
+
+    SUBCASE("element_size")
+    {
+        // Unknown element size only limits by max_elements_per_thread.
+        CHECK_EQ(calc_elements_per_thread(large, 0, 32, 16), 16u);
+        // 64 bytes per thread.
+        CHECK_EQ(calc_elements_per_thread(large, 4, 32, 64), 16u);
+        CHECK_EQ(calc_elements_per_thread(large, 16, 32, 64), 4u);
+        CHECK_EQ(calc_elements_per_thread(large, 64, 32, 64), 1u);
+        CHECK_EQ(calc_elements_per_thread(large, 256, 32, 64), 1u);
+    }
+
+    SUBCASE("power_of_two")
+    {
+        CHECK_EQ(calc_elements_per_thread(large, 0, 32, 7), 4u);
+        CHECK_EQ(calc_elements_per_thread(large, 12, 32, 64), 4u);
+    }
+
+    SUBCASE("min_thread_groups")
+    {
+        // 32 * 1024 threads is the minimum dispatch, so no coarsening below twice that.
+        CHECK_EQ(calc_elements_per_thread(32 * 1024, 4, 32, 16), 1u);
+        CHECK_EQ(calc_elements_per_thread(32 * 1024 * 2 - 1, 4, 32, 16), 1u);
+        CHECK_EQ(calc_elements_per_thread(32 * 1024 * 2, 4, 32, 16), 2u);
+        CHECK_EQ(calc_elements_per_thread(32 * 1024 * 5, 4, 32, 16), 4u);
+        CHECK_EQ(calc_elements_per_thread(100, 4, 32, 16), 1u);
+    }
+}
+
+TEST_SUITE_END();
@@ -0,0 +1,413 @@
+# SPDX-License-Identifier: Apache-2.0
+
+import pytest
+import sgl
+import sys
+import hashlib
+import threading
+import numpy as np
+from pathlib import Path
+
+sys.path.append(str(Path(__file__).parent.parent.parent / "device/tests"))
+import sglhelpers as helpers
+
+spy = sgl.slangpy
+
+KERNEL_SOURCE = r"""
+struct CallData {
+    int _call_stride[1];
+    int _call_dim[1];
+    uint3 _thread_count;
+    RWStructuredBuffer<uint> values;
+};
+ParameterBlock<CallData> call_data;
+
+[shader("compute")]
+[numthreads(32, 1, 1)]
+void main(uint3 tid: SV_DispatchThreadID)
+{
+    if (tid.x >= call_data._thread_count.x)
+        return;
+    call_data.values[tid.x] = tid.x * 2 + 1;
+}
+"""
+
+
+# Kernel with work coarsening support. Each thread processes _elements_per_thread
+# elements, strided by the number of dispatched threads. Writes the ID of the
+# thread that processed each element.
+COARSENED_KERNEL_SOURCE = r"""
+struct CallData {
+    int _call_stride[1];
+    int _call_dim[1];
+    uint3 _thread_count;
+    uint _elements_per_thread;
+    RWStructuredBuffer<uint> values;
+};
+ParameterBlock<CallData> call_data;
+
+[shader("compute")]
+[numthreads(32, 1, 1)]
+void main(uint3 tid: SV_DispatchThreadID)
+{
+    uint thread_count = call_data._thread_count.x;
+    uint elements_per_thread = call_data._elements_per_thread;
+    uint dispatch_count = (thread_count + elements_per_thread - 1) / elements_per_thread;
+    for (uint k = 0; k < elements_per_thread; ++k) {
+        uint i = tid.x + k * dispatch_count;
+        if (i >= thread_count)
+            return;
+        call_data.values[i] = tid.x;
+    }
+}
+"""
+
+KERNEL_2D_SOURCE = r"""
+struct CallData {
+    int _call_stride[2];
+    int _call_dim[2];
+    uint3 _thread_count;
+    RWStructuredBuffer<uint> values;
+};
+ParameterBlock<CallData> call_data;
+
+[shader("compute")]
+[numthreads(32, 1, 1)]
+void main(uint3 tid: SV_DispatchThreadID)
+{
+    if (tid.x >= call_data._thread_count.x)
+        return;
+    int i0 = tid.x / call_data._call_stride[0];
+    int i1 = (tid.x / call_data._call_stride[1]) % call_data._call_dim[1];
+    call_data.values[tid.x] = i0 * 1000 + i1;
+}
+"""
+
+# Same kernel, with the call shape class baked in as link time constants
+# (see NativeCallData.call_shape_link_constants).
+SPECIALIZED_KERNEL_2D_SOURCE = r"""
+extern static const int _call_stride_0;
+extern static const int _call_stride_1;
+extern static const int _call_dim_1;
+
+struct CallData {
+    int _call_dim[2];
+    uint3 _thread_count;
+    RWStructuredBuffer<uint> values;
+};
+ParameterBlock<CallData> call_data;
+
+[shader("compute")]
+[numthreads(32, 1, 1)]
+void main(uint3 tid: SV_DispatchThreadID)
+{
+    if (tid.x >= call_data._thread_count.x)
+        return;
+    int i0 = tid.x / _call_stride_0;
+    int i1 = (tid.x / _call_stride_1) % _call_dim_1;
+    call_data.values[tid.x] = i0 * 1000 + i1;
+}
+"""
+
+
+class Values:
+    """Python value filled in by the kernel, read back by ReadBackMarshall."""
+
+    def __init__(self, shape: int | tuple[int, ...]):
+        super().__init__()
+        self.shape = (shape,) if isinstance(shape, int) else shape
+        self.count = int(np.prod(self.shape))
+        self.result = None
+
+
+class ReadBackMarshall(spy.NativeMarshall):
+    """Python marshall that binds a buffer and stores it for read back itself."""
+
+    def __init__(self):
+        super().__init__()
+        self.match_call_shape = False
+
+    def get_shape(self, value: Values):
+        return spy.Shape(value.shape)
+
+    def write_shader_cursor_pre_dispatch(
+        self,
+        context: spy.CallContext,
+        binding: spy.NativeBoundVariableRuntime,
+        cursor: sgl.ShaderCursor,
+        value: Values,
+        read_back: list,
+    ):
+        buffer = context.device.create_buffer(
+            element_count=value.count,
+            struct_size=4,
+            usage=sgl.BufferUsage.shader_resource | sgl.BufferUsage.unordered_access,
+        )
+        cursor[binding.variable_name] = buffer
+        read_back.append((binding, value, buffer))
+
+    def read_calldata(
+        self,
+        context: spy.CallContext,
+        binding: spy.NativeBoundVariableRuntime,
+        data: Values,
+        result: sgl.Buffer,
+    ):
+        data.result = result.to_numpy().view(np.uint32)
+
+
+class FailingReadBackMarshall(ReadBackMarshall):
+    """Marshall that fails to read back its call data."""
+
+    def read_calldata(
+        self,
+        context: spy.CallContext,
+        binding: spy.NativeBoundVariableRuntime,
+        data: Values,
+        result: sgl.Buffer,
+    ):
+        raise RuntimeError("read back failed")
+
+
+def load_module(device: sgl.Device, source: str):
+    module_name = "test_slangpy_" + hashlib.sha256(source.encode()).hexdigest()[0:8]
+    return device.load_module_from_source(module_name, source)
+
+
+def create_call_data(
+    device: sgl.Device,
+    source: str = KERNEL_SOURCE,
+    marshall: spy.NativeMarshall | None = None,
+    call_dimensionality: int = 1,
+):
+    module = load_module(device, source)
+    program = device.link_program([module], [module.entry_point("main")])
+
+    binding = spy.NativeBoundVariableRuntime()
+    binding.variable_name = "values"
+    binding.transform = spy.Shape(tuple(range(call_dimensionality)))
+    binding.python_type = marshall if marshall else ReadBackMarshall()
+
+    runtime = spy.NativeBoundCallRuntime()
+    runtime.args = [binding]
+
+    call_data = spy.NativeCallData()
+    call_data.device = device
+    call_data.kernel = device.create_compute_kernel(program)
+    call_data.call_dimensionality = call_dimensionality
+    call_data.runtime = runtime
+    return call_data
+
+
+def expected_values(count: int):
+    return np.arange(count, dtype=np.uint32) * 2 + 1
+
+
+def expected_values_2d(shape: tuple[int, int]):
+    values = np.arange(shape[0])[:, None] * 1000 + np.arange(shape[1])[None, :]
+    return values.flatten().astype(np.uint32)
+
+
+@pytest.mark.parametrize("device_type", helpers.DEFAULT_DEVICE_TYPES)
+def test_python_marshall_read_back(device_type: sgl.DeviceType):
+    device = helpers.get_device(device_type)
+    call_data = create_call_data(device)
+    opts = spy.NativeCallRuntimeOptions()
+
+    values = Values(100)
+    call_data.call(opts, values)
+
+    assert call_data.last_call_shape.as_list() == [100]
+    assert values.result is not None
+    assert np.all(values.result == expected_values(100))
+
+
+@pytest.mark.parametrize("device_type", helpers.DEFAULT_DEVICE_TYPES)
+def test_call_async(device_type: sgl.DeviceType):
+    device = helpers.get_device(device_type)
+    call_data = create_call_data(device)
+    opts = spy.NativeCallRuntimeOptions()
+
+    values = Values(100)
+    future = call_data.call_async(opts, values)
+    assert future.submit_id > 0
+
+    # Read back is deferred until the result is requested.
+    assert values.result is None
+    future.wait()
+    assert future.done()
+    assert values.result is None
+
+    assert future.result() is None
+    assert np.all(values.result == expected_values(100))
+
+    # The result is cached and read back is not performed again.
+    values.result = None
+    future.result()
+    assert values.result is None
+
+
+@pytest.mark.parametrize("device_type", helpers.DEFAULT_DEVICE_TYPES)
+def test_call_async_wait_all(device_type: sgl.DeviceType):
+    device = helpers.get_device(device_type)
+    call_data = create_call_data(device)
+    opts = spy.NativeCallRuntimeOptions()
+
+    counts = [1, 31, 32, 33, 1000]
+    values = [Values(count) for count in counts]
+    futures = [call_data.call_async(opts, v) for v in values]
+    submit_ids = [future.submit_id for future in futures]
+    assert submit_ids == sorted(submit_ids)
+    assert all(v.result is None for v in values)
+
+    # Resolving one future first must not affect the others.
+    futures[2].result()
+    assert values[2].result is not None
+
+    results = spy.NativeCallFuture.wait_all(futures)
+    assert len(results) == len(futures)
+    for count, v, future in zip(counts, values, futures):
+        assert future.done()
+        assert np.all(v.result == expected_values(count))
+
+    assert spy.NativeCallFuture.wait_all([]) == []
+
+
+@pytest.mark.parametrize("device_type", helpers.DEFAULT_DEVICE_TYPES)
+def test_call_async_read_back_error(device_type: sgl.DeviceType):
+    device = helpers.get_device(device_type)
+    call_data = create_call_data(device, marshall=FailingReadBackMarshall())
+    opts = spy.NativeCallRuntimeOptions()
+
+    # Errors during read back are raised when the result is requested.
+    future = call_data.call_async(opts, Values(10))
+    with pytest.raises(RuntimeError, match="read back failed"):
+        future.result()
+
+    futures = [call_data.call_async(opts, Values(10)) for _ in range(3)]
+    with pytest.raises(RuntimeError, match="read back failed"):
+        spy.NativeCallFuture.wait_all(futures)
+    assert all(future.done() for future in futures)
+
+    with pytest.raises(Exception):
+        spy.NativeCallFuture.wait_all([None])  # type: ignore
+
+
+@pytest.mark.parametrize("device_type", helpers.DEFAULT_DEVICE_TYPES)
+def test_call_multithreaded(device_type: sgl.DeviceType):
+    device = helpers.get_device(device_type)
+    # A fresh call data, so threads race on creating the kernel pipeline.
+    call_data = create_call_data(device)
+    opts = spy.NativeCallRuntimeOptions()
+
+    thread_count = 8
+    calls_per_thread = 20
+    barrier = threading.Barrier(thread_count)
+    errors = []
+
+    def worker(index: int):
+        try:
+            barrier.wait()
+            for i in range(calls_per_thread):
+                count = 1 + index * calls_per_thread + i
+                values = Values(count)
+                call_data.call(opts, values)
+                assert np.all(values.result == expected_values(count))
+        except Exception as e:
+            errors.append(e)
+
+    threads = [threading.Thread(target=worker, args=(i,)) for i in range(thread_count)]
+    for thread in threads:
+        thread.start()
+    for thread in threads:
+        thread.join()
+    assert errors == []
+    device.wait_for_idle()
+
+
+def test_call_shape_link_constants():
+    constants = spy.NativeCallData.call_shape_link_constants(spy.Shape((3, 4)))
+    assert "export static const int _call_stride_0 = 4;" in constants
+    assert "export static const int _call_stride_1 = 1;" in constants
+    assert "export static const int _call_dim_1 = 4;" in constants
+
+    # The outermost dimension is not part of the call shape class.
+    assert "_call_dim_0" not in constants
+    assert "_thread_count" not in constants
+    assert constants == spy.NativeCallData.call_shape_link_constants(spy.Shape((7, 4)))
+
+
+@pytest.mark.parametrize("device_type", helpers.DEFAULT_DEVICE_TYPES)
+def test_kernel_specializer(device_type: sgl.DeviceType):
+    device = helpers.get_device(device_type)
+    call_data = create_call_data(device, source=KERNEL_2D_SOURCE, call_dimensionality=2)
+    opts = spy.NativeCallRuntimeOptions()
+
+    specialized_module = load_module(device, SPECIALIZED_KERNEL_2D_SOURCE)
+    specializations = []
+
+    def specializer(call_shape: spy.Shape, link_constants: str):
+        specializations.append(call_shape.as_list())
+        constants_module = load_module(device, link_constants)
+        program = device.link_program(
+            [specialized_module, constants_module],
+            [specialized_module.entry_point("main")],
+        )
+        return device.create_compute_kernel(program)
+
+    call_data.kernel_specializer = specializer
+    call_data.max_kernel_specializations = 2
+
+    # Shapes that only differ in the outermost dimension share a specialized kernel.
+    # Beyond the limit, calls use the generic kernel and are counted as fallbacks.
+    for shape in [(3, 4), (7, 4), (2, 5), (3, 4), (3, 6), (1, 6)]:
+        values = Values(shape)
+        call_data.call(opts, values)
+        assert np.all(values.result == expected_values_2d(shape))
+
+    assert specializations == [[3, 4], [2, 5]]
+    assert call_data.kernel_specialization_count == 2
+    assert call_data.kernel_specialization_fallback_count == 2
+
+    # Resetting the specializer clears the cache.
+    call_data.kernel_specializer = None
+    assert call_data.kernel_specialization_count == 0
+    assert call_data.kernel_specialization_fallback_count == 0
+    values = Values((2, 3))
+    call_data.call(opts, values)
+    assert np.all(values.result == expected_values_2d((2, 3)))
+
+
+@pytest.mark.parametrize("device_type", helpers.DEFAULT_DEVICE_TYPES)
+def test_work_coarsening(device_type: sgl.DeviceType):
+    device = helpers.get_device(device_type)
+    call_data = create_call_data(device, source=COARSENED_KERNEL_SOURCE)
+    opts = spy.NativeCallRuntimeOptions()
+    assert call_data.max_elements_per_thread == 8
+
+    # Large calls are coarsened, keeping at least 1024 thread groups of 32 threads.
+    count = 8 * 32 * 1024
+    values = Values(count)
+    call_data.call(opts, values)
+    assert np.all(values.result == np.arange(count, dtype=np.uint32) % (32 * 1024))
+
+    count = 3 * 32 * 1024 + 5
+    values = Values(count)
+    call_data.call(opts, values)
+    dispatch_count = (count + 1) // 2
+    assert np.all(values.result == np.arange(count, dtype=np.uint32) % dispatch_count)
+
+    # Small calls and calls with coarsening disabled use one thread per element.
+    values = Values(1000)
+    call_data.call(opts, values)
+    assert np.all(values.result == np.arange(1000, dtype=np.uint32))
+
+    call_data.max_elements_per_thread = 1
+    count = 8 * 32 * 1024
+    values = Values(count)
+    call_data.call(opts, values)
+    assert np.all(values.result == np.arange(count, dtype=np.uint32))
+
+
+if __name__ == "__main__":
+    pytest.main([__file__, "-v", "-s"])